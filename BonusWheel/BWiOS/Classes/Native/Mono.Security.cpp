@@ -1938,7 +1938,7 @@ FINALLY_0055:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_13 = V_6;
-			V_8 = ((RuntimeObject*)IsInst((RuntimeObject*)L_13, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_8 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_13, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_14 = V_8;
 			if (!L_14)
 			{
@@ -14111,8 +14111,8 @@ IL_0022:
 		NullCheck(L_5);
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_7 = List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_inline(L_5, L_6, /*hidden argument*/List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_RuntimeMethod_var);
 		Material_tF7DB3BF0C24DEC2FE0CB51E5DF5053D5223C8598 * L_8 = V_1;
-		NullCheck(((RuntimeObject*)IsInst((RuntimeObject*)L_7, IMaterialModifier_tAC8DDB479CEB6915244BA50AE95BF3BBF9F2E84C_il2cpp_TypeInfo_var)));
-		Material_tF7DB3BF0C24DEC2FE0CB51E5DF5053D5223C8598 * L_9 = InterfaceFuncInvoker1< Material_tF7DB3BF0C24DEC2FE0CB51E5DF5053D5223C8598 *, Material_tF7DB3BF0C24DEC2FE0CB51E5DF5053D5223C8598 * >::Invoke(0 /* UnityEngine.Material UnityEngine.UI.IMaterialModifier::GetModifiedMaterial(UnityEngine.Material) */, IMaterialModifier_tAC8DDB479CEB6915244BA50AE95BF3BBF9F2E84C_il2cpp_TypeInfo_var, ((RuntimeObject*)IsInst((RuntimeObject*)L_7, IMaterialModifier_tAC8DDB479CEB6915244BA50AE95BF3BBF9F2E84C_il2cpp_TypeInfo_var)), L_8);
+		NullCheck(((RuntimeObject*)IsInstCached((RuntimeObject*)L_7, IMaterialModifier_tAC8DDB479CEB6915244BA50AE95BF3BBF9F2E84C_il2cpp_TypeInfo_var)));
+		Material_tF7DB3BF0C24DEC2FE0CB51E5DF5053D5223C8598 * L_9 = InterfaceFuncInvoker1< Material_tF7DB3BF0C24DEC2FE0CB51E5DF5053D5223C8598 *, Material_tF7DB3BF0C24DEC2FE0CB51E5DF5053D5223C8598 * >::Invoke(0 /* UnityEngine.Material UnityEngine.UI.IMaterialModifier::GetModifiedMaterial(UnityEngine.Material) */, IMaterialModifier_tAC8DDB479CEB6915244BA50AE95BF3BBF9F2E84C_il2cpp_TypeInfo_var, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_7, IMaterialModifier_tAC8DDB479CEB6915244BA50AE95BF3BBF9F2E84C_il2cpp_TypeInfo_var)), L_8);
 		V_1 = L_9;
 		// for (var i = 0; i < components.Count; i++)
 		int32_t L_10 = V_2;
@@ -15096,7 +15096,7 @@ IL_0053:
 		int32_t L_13 = V_4;
 		NullCheck(L_12);
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_14 = List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_inline(L_12, L_13, /*hidden argument*/List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_RuntimeMethod_var);
-		V_6 = ((RuntimeObject*)IsInst((RuntimeObject*)L_14, ICanvasRaycastFilter_t427CA6378988B8BC6C849D78CB01F1CB9708DBA2_il2cpp_TypeInfo_var));
+		V_6 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_14, ICanvasRaycastFilter_t427CA6378988B8BC6C849D78CB01F1CB9708DBA2_il2cpp_TypeInfo_var));
 		// if (filter == null)
 		RuntimeObject* L_15 = V_6;
 		if (!L_15)
@@ -14116,7 +14116,7 @@ IL_0034:
 		int32_t L_11 = V_1;
 		NullCheck(L_10);
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_12 = List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_inline(L_10, L_11, /*hidden argument*/List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_RuntimeMethod_var);
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_12, ILayoutSelfController_t426EE97AD2B0858F02AD86F7786135F7B65A4373_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_12, ILayoutSelfController_t426EE97AD2B0858F02AD86F7786135F7B65A4373_il2cpp_TypeInfo_var)))
 		{
 			goto IL_004f;
 		}
@@ -14164,7 +14164,7 @@ IL_0060:
 		int32_t L_22 = V_2;
 		NullCheck(L_21);
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_23 = List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_inline(L_21, L_22, /*hidden argument*/List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_RuntimeMethod_var);
-		if (((RuntimeObject*)IsInst((RuntimeObject*)L_23, ILayoutSelfController_t426EE97AD2B0858F02AD86F7786135F7B65A4373_il2cpp_TypeInfo_var)))
+		if (((RuntimeObject*)IsInstCached((RuntimeObject*)L_23, ILayoutSelfController_t426EE97AD2B0858F02AD86F7786135F7B65A4373_il2cpp_TypeInfo_var)))
 		{
 			goto IL_007b;
 		}
@@ -14948,8 +14948,8 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void U3CU3Ec_U3CRebuildU3Eb__12_0_m61C61EC7A1
 	{
 		// PerformLayoutCalculation(m_ToRebuild, e => (e as ILayoutElement).CalculateLayoutInputHorizontal());
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_0 = ___e0;
-		NullCheck(((RuntimeObject*)IsInst((RuntimeObject*)L_0, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var)));
-		InterfaceActionInvoker0::Invoke(0 /* System.Void UnityEngine.UI.ILayoutElement::CalculateLayoutInputHorizontal() */, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var, ((RuntimeObject*)IsInst((RuntimeObject*)L_0, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var)));
+		NullCheck(((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var)));
+		InterfaceActionInvoker0::Invoke(0 /* System.Void UnityEngine.UI.ILayoutElement::CalculateLayoutInputHorizontal() */, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var)));
 		return;
 	}
 }
@@ -14965,8 +14965,8 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void U3CU3Ec_U3CRebuildU3Eb__12_1_mAD1F54287D
 	{
 		// PerformLayoutControl(m_ToRebuild, e => (e as ILayoutController).SetLayoutHorizontal());
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_0 = ___e0;
-		NullCheck(((RuntimeObject*)IsInst((RuntimeObject*)L_0, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var)));
-		InterfaceActionInvoker0::Invoke(0 /* System.Void UnityEngine.UI.ILayoutController::SetLayoutHorizontal() */, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var, ((RuntimeObject*)IsInst((RuntimeObject*)L_0, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var)));
+		NullCheck(((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var)));
+		InterfaceActionInvoker0::Invoke(0 /* System.Void UnityEngine.UI.ILayoutController::SetLayoutHorizontal() */, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var)));
 		return;
 	}
 }
@@ -14982,8 +14982,8 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void U3CU3Ec_U3CRebuildU3Eb__12_2_m4C5955D09B
 	{
 		// PerformLayoutCalculation(m_ToRebuild, e => (e as ILayoutElement).CalculateLayoutInputVertical());
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_0 = ___e0;
-		NullCheck(((RuntimeObject*)IsInst((RuntimeObject*)L_0, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var)));
-		InterfaceActionInvoker0::Invoke(1 /* System.Void UnityEngine.UI.ILayoutElement::CalculateLayoutInputVertical() */, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var, ((RuntimeObject*)IsInst((RuntimeObject*)L_0, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var)));
+		NullCheck(((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var)));
+		InterfaceActionInvoker0::Invoke(1 /* System.Void UnityEngine.UI.ILayoutElement::CalculateLayoutInputVertical() */, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var)));
 		return;
 	}
 }
@@ -14999,8 +14999,8 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void U3CU3Ec_U3CRebuildU3Eb__12_3_mE471222E89
 	{
 		// PerformLayoutControl(m_ToRebuild, e => (e as ILayoutController).SetLayoutVertical());
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_0 = ___e0;
-		NullCheck(((RuntimeObject*)IsInst((RuntimeObject*)L_0, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var)));
-		InterfaceActionInvoker0::Invoke(1 /* System.Void UnityEngine.UI.ILayoutController::SetLayoutVertical() */, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var, ((RuntimeObject*)IsInst((RuntimeObject*)L_0, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var)));
+		NullCheck(((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var)));
+		InterfaceActionInvoker0::Invoke(1 /* System.Void UnityEngine.UI.ILayoutController::SetLayoutVertical() */, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, ILayoutController_t5B26CD1C7BB8896C0E9B8AD2A0A26EB86610FB5D_il2cpp_TypeInfo_var)));
 		return;
 	}
 }
@@ -15515,7 +15515,7 @@ IL_0035:
 		int32_t L_10 = V_3;
 		NullCheck(L_9);
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_11 = List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_inline(L_9, L_10, /*hidden argument*/List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_RuntimeMethod_var);
-		V_4 = ((RuntimeObject*)IsInst((RuntimeObject*)L_11, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var));
+		V_4 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_11, ILayoutElement_tE4DE1D4DB22AD1C457506C440310FE105356AA54_il2cpp_TypeInfo_var));
 		// if (layoutComp is Behaviour && !((Behaviour)layoutComp).isActiveAndEnabled)
 		RuntimeObject* L_12 = V_4;
 		if (!((Behaviour_tBDC7E9C3C898AD8348891B82D3E345801D920CA8 *)IsInstClass((RuntimeObject*)L_12, Behaviour_tBDC7E9C3C898AD8348891B82D3E345801D920CA8_il2cpp_TypeInfo_var)))
@@ -16461,7 +16461,7 @@ IL_0011:
 		int32_t L_15 = V_1;
 		NullCheck(L_14);
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_16 = List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_inline(L_14, L_15, /*hidden argument*/List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_RuntimeMethod_var);
-		V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_16, IClippable_t52018F1331129B74DEF629B08F6AA340F321B7E1_il2cpp_TypeInfo_var));
+		V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_16, IClippable_t52018F1331129B74DEF629B08F6AA340F321B7E1_il2cpp_TypeInfo_var));
 		// if (toNotify != null)
 		RuntimeObject* L_17 = V_2;
 		if (!L_17)
@@ -16568,7 +16568,7 @@ IL_0011:
 		int32_t L_15 = V_1;
 		NullCheck(L_14);
 		Component_t05064EF382ABCAF4B8C94F8A350EA85184C26621 * L_16 = List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_inline(L_14, L_15, /*hidden argument*/List_1_get_Item_mA6C019255203C3A859BB0856B40200EA1E5F8EDA_RuntimeMethod_var);
-		V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_16, IMaskable_t7278CAD244080AE40DF756E7B1FD4C785709E884_il2cpp_TypeInfo_var));
+		V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_16, IMaskable_t7278CAD244080AE40DF756E7B1FD4C785709E884_il2cpp_TypeInfo_var));
 		// if (toNotify != null)
 		RuntimeObject* L_17 = V_2;
 		if (!L_17)
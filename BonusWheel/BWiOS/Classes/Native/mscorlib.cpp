@@ -16629,7 +16629,7 @@ FINALLY_00a0:
 			{ // begin finally (depth: 3)
 				{
 					RuntimeObject* L_28 = V_3;
-					V_5 = ((RuntimeObject*)IsInst((RuntimeObject*)L_28, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+					V_5 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_28, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 					RuntimeObject* L_29 = V_5;
 					if (!L_29)
 					{
@@ -17052,7 +17052,7 @@ FINALLY_0175:
 		{ // begin finally (depth: 2)
 			{
 				RuntimeObject* L_64 = V_4;
-				V_6 = ((RuntimeObject*)IsInst((RuntimeObject*)L_64, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+				V_6 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_64, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 				RuntimeObject* L_65 = V_6;
 				if (!L_65)
 				{
@@ -18564,7 +18564,7 @@ FINALLY_006d:
 		{ // begin finally (depth: 2)
 			{
 				RuntimeObject* L_18 = V_4;
-				V_6 = ((RuntimeObject*)IsInst((RuntimeObject*)L_18, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+				V_6 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_18, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 				RuntimeObject* L_19 = V_6;
 				if (!L_19)
 				{
@@ -19463,7 +19463,7 @@ IL_00fc:
 IL_0120:
 			{
 				RuntimeObject * L_32 = V_5;
-				if (!((ByteU5BU5D_tD06FDBE8142446525DF1C40351D523A228373821*)IsInst((RuntimeObject*)L_32, ByteU5BU5D_tD06FDBE8142446525DF1C40351D523A228373821_il2cpp_TypeInfo_var)))
+				if (!((ByteU5BU5D_tD06FDBE8142446525DF1C40351D523A228373821*)IsInstCached((RuntimeObject*)L_32, ByteU5BU5D_tD06FDBE8142446525DF1C40351D523A228373821_il2cpp_TypeInfo_var)))
 				{
 					goto IL_0152;
 				}
@@ -19511,7 +19511,7 @@ IL_015b:
 IL_0181:
 			{
 				RuntimeObject * L_43 = V_5;
-				if (!((StringU5BU5D_t933FB07893230EA91C40FF900D5400665E87B14E*)IsInst((RuntimeObject*)L_43, StringU5BU5D_t933FB07893230EA91C40FF900D5400665E87B14E_il2cpp_TypeInfo_var)))
+				if (!((StringU5BU5D_t933FB07893230EA91C40FF900D5400665E87B14E*)IsInstCached((RuntimeObject*)L_43, StringU5BU5D_t933FB07893230EA91C40FF900D5400665E87B14E_il2cpp_TypeInfo_var)))
 				{
 					goto IL_01e1;
 				}
@@ -19598,7 +19598,7 @@ FINALLY_01f6:
 		{ // begin finally (depth: 2)
 			{
 				RuntimeObject* L_63 = V_3;
-				V_11 = ((RuntimeObject*)IsInst((RuntimeObject*)L_63, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+				V_11 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_63, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 				RuntimeObject* L_64 = V_11;
 				if (!L_64)
 				{
@@ -39520,7 +39520,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void AggregateException__ctor_mEB0710D0C50475
 	{
 		String_t* L_0 = ___message0;
 		RuntimeObject* L_1 = ___innerExceptions1;
-		RuntimeObject* L_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_1, IList_1_t79A79A556E69BA20A09771D2D61B0440B6F4EFBA_il2cpp_TypeInfo_var));
+		RuntimeObject* L_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_1, IList_1_t79A79A556E69BA20A09771D2D61B0440B6F4EFBA_il2cpp_TypeInfo_var));
 		G_B1_0 = L_2;
 		G_B1_1 = L_0;
 		G_B1_2 = __this;
@@ -39759,7 +39759,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void AggregateException__ctor_m49EF2FE10BC147
 	{
 		String_t* L_0 = ___message0;
 		RuntimeObject* L_1 = ___innerExceptionInfos1;
-		RuntimeObject* L_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_1, IList_1_t1D32293C65F49E1B7D7E3344057FED3589CD8F1F_il2cpp_TypeInfo_var));
+		RuntimeObject* L_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_1, IList_1_t1D32293C65F49E1B7D7E3344057FED3589CD8F1F_il2cpp_TypeInfo_var));
 		G_B1_0 = L_2;
 		G_B1_1 = L_0;
 		G_B1_2 = __this;
@@ -40018,7 +40018,7 @@ IL_0016:
 		Type_t * L_6 = Type_GetTypeFromHandle_m9DC58ADF0512987012A8A016FB64B068F3B1AFF6(L_5, /*hidden argument*/NULL);
 		NullCheck(L_4);
 		RuntimeObject * L_7 = SerializationInfo_GetValue_m7910CE6C68888C1F863D7A35915391FA33463ECF(L_4, _stringLiteralDED869EF491FCACB00F4A7F3129E19FBF775198F, L_6, /*hidden argument*/NULL);
-		V_0 = ((ExceptionU5BU5D_t09C3EFFA7CF3F84DA802016E2017E1608442F209*)IsInst((RuntimeObject*)L_7, ExceptionU5BU5D_t09C3EFFA7CF3F84DA802016E2017E1608442F209_il2cpp_TypeInfo_var));
+		V_0 = ((ExceptionU5BU5D_t09C3EFFA7CF3F84DA802016E2017E1608442F209*)IsInstCached((RuntimeObject*)L_7, ExceptionU5BU5D_t09C3EFFA7CF3F84DA802016E2017E1608442F209_il2cpp_TypeInfo_var));
 		ExceptionU5BU5D_t09C3EFFA7CF3F84DA802016E2017E1608442F209* L_8 = V_0;
 		if (L_8)
 		{
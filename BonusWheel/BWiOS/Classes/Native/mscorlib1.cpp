@@ -11454,7 +11454,7 @@ IL_0066:
 		int32_t L_18 = ___length2;
 		V_1 = ((int32_t)il2cpp_codegen_subtract((int32_t)((int32_t)il2cpp_codegen_add((int32_t)L_17, (int32_t)L_18)), (int32_t)1));
 		RuntimeArray * L_19 = ___array0;
-		V_2 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInst((RuntimeObject*)L_19, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
+		V_2 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInstCached((RuntimeObject*)L_19, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
 		ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A* L_20 = V_2;
 		if (!L_20)
 		{
@@ -11835,7 +11835,7 @@ IL_005a:
 IL_006a:
 	{
 		RuntimeArray * L_21 = ___array0;
-		V_1 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInst((RuntimeObject*)L_21, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
+		V_1 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInstCached((RuntimeObject*)L_21, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
 		int32_t L_22 = ___startIndex2;
 		int32_t L_23 = ___count3;
 		V_2 = ((int32_t)il2cpp_codegen_add((int32_t)L_22, (int32_t)L_23));
@@ -12204,7 +12204,7 @@ IL_005f:
 IL_0073:
 	{
 		RuntimeArray * L_17 = ___array0;
-		V_0 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInst((RuntimeObject*)L_17, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
+		V_0 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInstCached((RuntimeObject*)L_17, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
 		int32_t L_18 = ___startIndex2;
 		int32_t L_19 = ___count3;
 		V_1 = ((int32_t)il2cpp_codegen_add((int32_t)((int32_t)il2cpp_codegen_subtract((int32_t)L_18, (int32_t)L_19)), (int32_t)1));
@@ -12541,7 +12541,7 @@ IL_0065:
 		int32_t L_21 = ___length2;
 		V_2 = ((int32_t)il2cpp_codegen_subtract((int32_t)((int32_t)il2cpp_codegen_add((int32_t)L_20, (int32_t)L_21)), (int32_t)1));
 		RuntimeArray * L_22 = ___array0;
-		V_3 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInst((RuntimeObject*)L_22, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
+		V_3 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInstCached((RuntimeObject*)L_22, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
 		ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A* L_23 = V_3;
 		if (!L_23)
 		{
@@ -14894,7 +14894,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void Array_SortImpl_m69441E6855557430ED593463
 	memset((&V_3), 0, sizeof(V_3));
 	{
 		RuntimeArray * L_0 = ___keys0;
-		V_0 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInst((RuntimeObject*)L_0, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
+		V_0 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInstCached((RuntimeObject*)L_0, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
 		V_1 = (ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)NULL;
 		ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A* L_1 = V_0;
 		if (!L_1)
@@ -14904,7 +14904,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void Array_SortImpl_m69441E6855557430ED593463
 	}
 	{
 		RuntimeArray * L_2 = ___items1;
-		V_1 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInst((RuntimeObject*)L_2, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
+		V_1 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInstCached((RuntimeObject*)L_2, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
 	}
 
 IL_0013:
@@ -17737,7 +17737,7 @@ IL_0088:
 		bool L_30 = ___inherit2;
 		NullCheck(L_28);
 		ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A* L_31 = VirtFuncInvoker2< ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*, Type_t *, bool >::Invoke(11 /* System.Object[] System.Reflection.MemberInfo::GetCustomAttributes(System.Type,System.Boolean) */, L_28, L_29, L_30);
-		return ((AttributeU5BU5D_t777BEFAB7857CFA5F0EE6C3EB1F8F7FF61F00A17*)IsInst((RuntimeObject*)L_31, AttributeU5BU5D_t777BEFAB7857CFA5F0EE6C3EB1F8F7FF61F00A17_il2cpp_TypeInfo_var));
+		return ((AttributeU5BU5D_t777BEFAB7857CFA5F0EE6C3EB1F8F7FF61F00A17*)IsInstCached((RuntimeObject*)L_31, AttributeU5BU5D_t777BEFAB7857CFA5F0EE6C3EB1F8F7FF61F00A17_il2cpp_TypeInfo_var));
 	}
 }
 // System.Boolean System.Attribute::IsDefined(System.Reflection.MemberInfo,System.Type)
@@ -22665,7 +22665,7 @@ FINALLY_0067:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_28 = V_0;
-			V_4 = ((RuntimeObject*)IsInst((RuntimeObject*)L_28, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_4 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_28, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_29 = V_4;
 			if (!L_29)
 			{
@@ -26414,7 +26414,7 @@ IL_0010:
 IL_003a:
 	{
 		RuntimeObject * L_13 = ___a0;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_13, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_13, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
 		RuntimeObject* L_14 = V_0;
 		if (!L_14)
 		{
@@ -26432,7 +26432,7 @@ IL_003a:
 IL_004c:
 	{
 		RuntimeObject * L_18 = ___b1;
-		V_1 = ((RuntimeObject*)IsInst((RuntimeObject*)L_18, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
+		V_1 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_18, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
 		RuntimeObject* L_19 = V_1;
 		if (!L_19)
 		{
@@ -26605,7 +26605,7 @@ IL_0010:
 IL_0026:
 	{
 		RuntimeObject * L_9 = ___a0;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_9, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_9, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
 		RuntimeObject* L_10 = V_0;
 		if (!L_10)
 		{
@@ -33215,7 +33215,7 @@ IL_000b:
 IL_0010:
 	{
 		RuntimeObject * L_4 = ___a0;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_4, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_4, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
 		RuntimeObject* L_5 = V_0;
 		if (!L_5)
 		{
@@ -33233,7 +33233,7 @@ IL_0010:
 IL_0022:
 	{
 		RuntimeObject * L_9 = ___b1;
-		V_1 = ((RuntimeObject*)IsInst((RuntimeObject*)L_9, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
+		V_1 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_9, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
 		RuntimeObject* L_10 = V_1;
 		if (!L_10)
 		{
@@ -13501,7 +13501,7 @@ IL_003c:
 		int32_t L_8 = V_0;
 		NullCheck(L_7);
 		RuntimeObject* L_9 = List_1_get_Item_m072A084F4736F385CC4878F7C0E57B33A91BC25D_inline(L_7, L_8, /*hidden argument*/List_1_get_Item_m072A084F4736F385CC4878F7C0E57B33A91BC25D_RuntimeMethod_var);
-		V_1 = ((RuntimeObject*)IsInst((RuntimeObject*)L_9, IContributeServerContextSink_t36D9256ED2C07E350009A8633130645D3FD55A4B_il2cpp_TypeInfo_var));
+		V_1 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_9, IContributeServerContextSink_t36D9256ED2C07E350009A8633130645D3FD55A4B_il2cpp_TypeInfo_var));
 		RuntimeObject* L_10 = V_1;
 		if (!L_10)
 		{
@@ -13590,7 +13590,7 @@ IL_0028:
 IL_002a:
 		{
 			RuntimeObject* L_5 = Enumerator_get_Current_mC2867EF3B339DEFC411FF240645BFFF5B306ABA6_inline((Enumerator_t325D17010597AC6F36BB11A1C47B1D1E62FEB163 *)(&V_0), /*hidden argument*/Enumerator_get_Current_mC2867EF3B339DEFC411FF240645BFFF5B306ABA6_RuntimeMethod_var);
-			V_1 = ((RuntimeObject*)IsInst((RuntimeObject*)L_5, IContributeClientContextSink_tD2FDF822E8DE6FFEAAF9CEEE8D3BC738267AB408_il2cpp_TypeInfo_var));
+			V_1 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_5, IContributeClientContextSink_tD2FDF822E8DE6FFEAAF9CEEE8D3BC738267AB408_il2cpp_TypeInfo_var));
 			RuntimeObject* L_6 = V_1;
 			if (!L_6)
 			{
@@ -13690,7 +13690,7 @@ IL_002e:
 		int32_t L_11 = V_1;
 		NullCheck(L_10);
 		RuntimeObject* L_12 = List_1_get_Item_m072A084F4736F385CC4878F7C0E57B33A91BC25D_inline(L_10, L_11, /*hidden argument*/List_1_get_Item_m072A084F4736F385CC4878F7C0E57B33A91BC25D_RuntimeMethod_var);
-		V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_12, IContributeObjectSink_t9EBF2882BE76CE70E53BF0DBC22310F47F52644E_il2cpp_TypeInfo_var));
+		V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_12, IContributeObjectSink_t9EBF2882BE76CE70E53BF0DBC22310F47F52644E_il2cpp_TypeInfo_var));
 		RuntimeObject* L_13 = V_2;
 		if (!L_13)
 		{
@@ -13774,7 +13774,7 @@ IL_001a:
 IL_001c:
 		{
 			RuntimeObject* L_4 = Enumerator_get_Current_mC2867EF3B339DEFC411FF240645BFFF5B306ABA6_inline((Enumerator_t325D17010597AC6F36BB11A1C47B1D1E62FEB163 *)(&V_1), /*hidden argument*/Enumerator_get_Current_mC2867EF3B339DEFC411FF240645BFFF5B306ABA6_RuntimeMethod_var);
-			V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_4, IContributeEnvoySink_tA10E4EC3942D2871B006A519489F2D637D760964_il2cpp_TypeInfo_var));
+			V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_4, IContributeEnvoySink_tA10E4EC3942D2871B006A519489F2D637D760964_il2cpp_TypeInfo_var));
 			RuntimeObject* L_5 = V_2;
 			if (!L_5)
 			{
@@ -13929,7 +13929,7 @@ FINALLY_003f:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_14 = V_1;
-			V_3 = ((RuntimeObject*)IsInst((RuntimeObject*)L_14, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_3 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_14, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_15 = V_3;
 			if (!L_15)
 			{
@@ -14022,7 +14022,7 @@ FINALLY_008c:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_28 = V_1;
-			V_3 = ((RuntimeObject*)IsInst((RuntimeObject*)L_28, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_3 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_28, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_29 = V_3;
 			if (!L_29)
 			{
@@ -15048,7 +15048,7 @@ IL_0026:
 			NullCheck(L_8);
 			L_8->set_Property_0(L_9);
 			RuntimeObject* L_10 = ___prop0;
-			V_4 = ((RuntimeObject*)IsInst((RuntimeObject*)L_10, IContributeDynamicSink_t82A806D1417AFB21C9AC160C2D6B75C2AAEACC97_il2cpp_TypeInfo_var));
+			V_4 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_10, IContributeDynamicSink_t82A806D1417AFB21C9AC160C2D6B75C2AAEACC97_il2cpp_TypeInfo_var));
 			RuntimeObject* L_11 = V_4;
 			if (!L_11)
 			{
@@ -15313,7 +15313,7 @@ FINALLY_0040:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_15 = V_1;
-			V_3 = ((RuntimeObject*)IsInst((RuntimeObject*)L_15, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_3 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_15, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_16 = V_3;
 			if (!L_16)
 			{
@@ -15407,7 +15407,7 @@ FINALLY_008a:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_31 = V_1;
-			V_3 = ((RuntimeObject*)IsInst((RuntimeObject*)L_31, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_3 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_31, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_32 = V_3;
 			if (!L_32)
 			{
@@ -18470,7 +18470,7 @@ FINALLY_0064:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_24 = V_3;
-			V_5 = ((RuntimeObject*)IsInst((RuntimeObject*)L_24, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_5 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_24, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_25 = V_5;
 			if (!L_25)
 			{
@@ -18580,7 +18580,7 @@ FINALLY_00b9:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_44 = V_3;
-			V_5 = ((RuntimeObject*)IsInst((RuntimeObject*)L_44, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_5 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_44, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_45 = V_5;
 			if (!L_45)
 			{
@@ -19655,7 +19655,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR CADMethodCallMessage_t7B9A972EAA7214F4072621D
 	RuntimeObject* V_0 = NULL;
 	{
 		RuntimeObject* L_0 = ___callMsg0;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_0, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var));
 		RuntimeObject* L_1 = V_0;
 		if (L_1)
 		{
@@ -20290,7 +20290,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR CADMethodReturnMessage_tC46DD1930F6C9F9EF55AA
 	RuntimeObject* V_0 = NULL;
 	{
 		RuntimeObject* L_0 = ___callMsg0;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_0, IMethodReturnMessage_tF73EC49214910CFE7305EF5891608B3556D273BF_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, IMethodReturnMessage_tF73EC49214910CFE7305EF5891608B3556D273BF_il2cpp_TypeInfo_var));
 		RuntimeObject* L_1 = V_0;
 		if (L_1)
 		{
@@ -20773,7 +20773,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR RuntimeObject* ClientContextTerminatorSink_Sy
 		NullCheck(L_1);
 		Context_NotifyDynamicSinks_m3685359372BE120CAE3E52848B7AA1C56D471191(L_1, (bool)1, L_2, (bool)1, (bool)0, /*hidden argument*/NULL);
 		RuntimeObject* L_3 = ___msg0;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_3, IConstructionCallMessage_t2ACEF19300C83A5D9556376D8E305CDD94B7758D_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_3, IConstructionCallMessage_t2ACEF19300C83A5D9556376D8E305CDD94B7758D_il2cpp_TypeInfo_var)))
 		{
 			goto IL_002e;
 		}
@@ -23793,7 +23793,7 @@ FINALLY_007c:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_21 = V_2;
-			V_4 = ((RuntimeObject*)IsInst((RuntimeObject*)L_21, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_4 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_21, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_22 = V_4;
 			if (!L_22)
 			{
@@ -24842,7 +24842,7 @@ FINALLY_00bc:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_24 = V_0;
-			V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_24, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_24, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_25 = V_2;
 			if (!L_25)
 			{
@@ -26713,7 +26713,7 @@ FINALLY_00d7:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_27 = V_0;
-			V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_27, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_27, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_28 = V_2;
 			if (!L_28)
 			{
@@ -28553,7 +28553,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR RuntimeObject* ServerContextTerminatorSink_Sy
 	}
 	{
 		RuntimeObject* L_0 = ___msg0;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_0, IConstructionCallMessage_t2ACEF19300C83A5D9556376D8E305CDD94B7758D_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, IConstructionCallMessage_t2ACEF19300C83A5D9556376D8E305CDD94B7758D_il2cpp_TypeInfo_var)))
 		{
 			goto IL_0014;
 		}
@@ -30265,7 +30265,7 @@ FINALLY_008d:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_22 = V_0;
-			V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_22, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_22, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_23 = V_2;
 			if (!L_23)
 			{
@@ -30369,7 +30369,7 @@ FINALLY_00ec:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_38 = V_3;
-			V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_38, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_38, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_39 = V_2;
 			if (!L_39)
 			{
@@ -30857,12 +30857,12 @@ IL_00ab:
 			Exception_t * L_34 = V_5;
 			RuntimeObject* L_35 = ___msg1;
 			ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03 * L_36 = (ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03 *)il2cpp_codegen_object_new(ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03_il2cpp_TypeInfo_var);
-			ReturnMessage__ctor_mA17F87483A741789E4E5CAF7D3A1F8DCF32CB57E(L_36, L_34, ((RuntimeObject*)IsInst((RuntimeObject*)L_35, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
+			ReturnMessage__ctor_mA17F87483A741789E4E5CAF7D3A1F8DCF32CB57E(L_36, L_34, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_35, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
 			NullCheck(L_33);
 			VirtFuncInvoker1< RuntimeObject*, RuntimeObject* >::Invoke(18 /* System.Runtime.Remoting.Messaging.IMessage System.Runtime.Remoting.Messaging.AsyncResult::SyncProcessMessage(System.Runtime.Remoting.Messaging.IMessage) */, L_33, L_36);
 			RuntimeObject* L_37 = ___msg1;
 			ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03 * L_38 = (ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03 *)il2cpp_codegen_object_new(ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03_il2cpp_TypeInfo_var);
-			ReturnMessage__ctor_mA81E63533AD1024E6378B26E2FF6F3391460D271(L_38, NULL, (ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)(ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)NULL, 0, (LogicalCallContext_t3A9A7C02A28577F0879F6E950E46EEC595731D7E *)NULL, ((RuntimeObject*)IsInst((RuntimeObject*)L_37, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
+			ReturnMessage__ctor_mA81E63533AD1024E6378B26E2FF6F3391460D271(L_38, NULL, (ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)(ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)NULL, 0, (LogicalCallContext_t3A9A7C02A28577F0879F6E950E46EEC595731D7E *)NULL, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_37, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
 			V_3 = L_38;
 			goto IL_00d8;
 		}
@@ -30915,7 +30915,7 @@ IL_00da:
 		Il2CppCodeGenWriteBarrier((void**)(RuntimeObject **)L_46, (void*)(RuntimeObject *)L_48);
 		RuntimeObject* L_49 = V_3;
 		ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03 * L_50 = (ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03 *)il2cpp_codegen_object_new(ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03_il2cpp_TypeInfo_var);
-		ReturnMessage__ctor_mA81E63533AD1024E6378B26E2FF6F3391460D271(L_50, L_45, (ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)(ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)NULL, 0, (LogicalCallContext_t3A9A7C02A28577F0879F6E950E46EEC595731D7E *)NULL, ((RuntimeObject*)IsInst((RuntimeObject*)L_49, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
+		ReturnMessage__ctor_mA81E63533AD1024E6378B26E2FF6F3391460D271(L_50, L_45, (ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)(ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)NULL, 0, (LogicalCallContext_t3A9A7C02A28577F0879F6E950E46EEC595731D7E *)NULL, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_49, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
 		V_3 = L_50;
 	}
 
@@ -30982,7 +30982,7 @@ IL_0137:
 IL_014e:
 	{
 		RuntimeObject* L_70 = V_3;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_70, IConstructionReturnMessage_tD78C6B12128C5D713E531737E203DDB7CC447B2B_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_70, IConstructionReturnMessage_tD78C6B12128C5D713E531737E203DDB7CC447B2B_il2cpp_TypeInfo_var)))
 		{
 			goto IL_0164;
 		}
@@ -31110,7 +31110,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR RuntimeObject * RealProxy_GetTransparentProxy
 		}
 	}
 	{
-		V_1 = ((RuntimeObject*)IsInst((RuntimeObject*)__this, IRemotingTypeInfo_t510B5BDF4B8C7290A270755122F69C90EDE1B56C_il2cpp_TypeInfo_var));
+		V_1 = ((RuntimeObject*)IsInstCached((RuntimeObject*)__this, IRemotingTypeInfo_t510B5BDF4B8C7290A270755122F69C90EDE1B56C_il2cpp_TypeInfo_var));
 		RuntimeObject* L_1 = V_1;
 		if (!L_1)
 		{
@@ -31587,7 +31587,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR RuntimeObject* RemotingProxy_Invoke_m1DA60629
 	RuntimeObject* V_6 = NULL;
 	{
 		RuntimeObject* L_0 = ___request0;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_0, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var));
 		RuntimeObject* L_1 = V_0;
 		if (!L_1)
 		{
@@ -31642,7 +31642,7 @@ IL_0035:
 IL_0056:
 	{
 		RuntimeObject* L_19 = ___request0;
-		V_1 = ((RuntimeObject*)IsInst((RuntimeObject*)L_19, IInternalMessage_t58FBC0B8066E38849394FD87833FBE9A68E85FAE_il2cpp_TypeInfo_var));
+		V_1 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_19, IInternalMessage_t58FBC0B8066E38849394FD87833FBE9A68E85FAE_il2cpp_TypeInfo_var));
 		RuntimeObject* L_20 = V_1;
 		if (!L_20)
 		{
@@ -33603,7 +33603,7 @@ FINALLY_00fe:
 		{ // begin finally (depth: 2)
 			{
 				RuntimeObject* L_45 = V_3;
-				V_6 = ((RuntimeObject*)IsInst((RuntimeObject*)L_45, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+				V_6 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_45, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 				RuntimeObject* L_46 = V_6;
 				if (!L_46)
 				{
@@ -33723,7 +33723,7 @@ FINALLY_0181:
 		{ // begin finally (depth: 2)
 			{
 				RuntimeObject* L_68 = V_3;
-				V_6 = ((RuntimeObject*)IsInst((RuntimeObject*)L_68, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+				V_6 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_68, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 				RuntimeObject* L_69 = V_6;
 				if (!L_69)
 				{
@@ -33782,7 +33782,7 @@ FINALLY_01a8:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_74 = V_0;
-			V_6 = ((RuntimeObject*)IsInst((RuntimeObject*)L_74, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_6 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_74, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_75 = V_6;
 			if (!L_75)
 			{
@@ -33943,7 +33943,7 @@ FINALLY_0071:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_14 = V_0;
-			V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_14, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_14, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_15 = V_2;
 			if (!L_15)
 			{
@@ -36900,7 +36900,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR Identity_tB4E8BEFF42D505C9B24C9284934E6538F29
 	NO_UNUSED_WARNING (__leave_targets);
 	{
 		RuntimeObject* L_0 = ___msg0;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_0, IInternalMessage_t58FBC0B8066E38849394FD87833FBE9A68E85FAE_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, IInternalMessage_t58FBC0B8066E38849394FD87833FBE9A68E85FAE_il2cpp_TypeInfo_var)))
 		{
 			goto IL_0014;
 		}
@@ -36988,7 +36988,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void RemotingServices_SetMessageTargetIdentit
 	}
 	{
 		RuntimeObject* L_0 = ___msg0;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_0, IInternalMessage_t58FBC0B8066E38849394FD87833FBE9A68E85FAE_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, IInternalMessage_t58FBC0B8066E38849394FD87833FBE9A68E85FAE_il2cpp_TypeInfo_var)))
 		{
 			goto IL_0014;
 		}
@@ -15241,7 +15241,7 @@ IL_0021:
 		RuntimeObject* L_9 = InterfaceFuncInvoker1< RuntimeObject*, RuntimeObject* >::Invoke(0 /* System.Runtime.Remoting.Messaging.IMessage System.Runtime.Remoting.Messaging.IMessageSink::SyncProcessMessage(System.Runtime.Remoting.Messaging.IMessage) */, IMessageSink_tB1CED1C3E8A2782C843D48468DB443B7940FC76C_il2cpp_TypeInfo_var, L_7, L_8);
 		MarshalByRefObject_tC4577953D0A44D0AB8597CFA868E01C858B1C9AF * L_10 = V_0;
 		G_B3_0 = L_9;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_10, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_10, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var)))
 		{
 			G_B4_0 = L_9;
 			goto IL_0047;
@@ -15281,7 +15281,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR RuntimeObject* SingleCallIdentity_AsyncObject
 		RuntimeObject* L_4 = Context_CreateServerObjectSinkChain_m6923378542152C208060176D6C466905C1AE7B25(L_2, L_3, (bool)0, /*hidden argument*/NULL);
 		MarshalByRefObject_tC4577953D0A44D0AB8597CFA868E01C858B1C9AF * L_5 = V_0;
 		G_B1_0 = L_4;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_5, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_5, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var)))
 		{
 			G_B2_0 = L_4;
 			goto IL_0035;
@@ -25781,7 +25781,7 @@ IL_00b0:
 IL_00e2:
 	{
 		RuntimeObject * L_27 = ObjectReader_get_TopObject_m0C40528A94E0C835BBA4A4730B11E9F1CF1035C1_inline(__this, /*hidden argument*/NULL);
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_27, IObjectReference_t6CDA6360AB0728B0A65C44CFEECA24F338134E80_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_27, IObjectReference_t6CDA6360AB0728B0A65C44CFEECA24F338134E80_il2cpp_TypeInfo_var)))
 		{
 			goto IL_010b;
 		}
@@ -36180,7 +36180,7 @@ IL_00a2:
 IL_00a9:
 	{
 		RuntimeObject * L_27 = ___obj0;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_27, ISerializable_t6367D17788BC3D11199A6922F5932FB0DB2F2815_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_27, ISerializable_t6367D17788BC3D11199A6922F5932FB0DB2F2815_il2cpp_TypeInfo_var)))
 		{
 			goto IL_0143;
 		}
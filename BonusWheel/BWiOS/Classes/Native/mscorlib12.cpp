@@ -17000,7 +17000,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void ObjectHolder_SetFlags_m788E99E1E37C29C85
 	}
 	{
 		RuntimeObject * L_0 = __this->get_m_object_0();
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_0, IObjectReference_t6CDA6360AB0728B0A65C44CFEECA24F338134E80_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, IObjectReference_t6CDA6360AB0728B0A65C44CFEECA24F338134E80_il2cpp_TypeInfo_var)))
 		{
 			goto IL_001b;
 		}
@@ -17029,7 +17029,7 @@ IL_001b:
 IL_0042:
 	{
 		RuntimeObject * L_5 = __this->get_m_object_0();
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_5, ISerializable_t6367D17788BC3D11199A6922F5932FB0DB2F2815_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_5, ISerializable_t6367D17788BC3D11199A6922F5932FB0DB2F2815_il2cpp_TypeInfo_var)))
 		{
 			goto IL_005d;
 		}
@@ -18960,7 +18960,7 @@ IL_0053:
 			ObjectHolder_t11F223E6C83960E12DAC164F1ADAAC47D4A2C942 * L_15 = ___holder0;
 			NullCheck(L_15);
 			RuntimeObject * L_16 = ObjectHolder_get_ObjectValue_mB82D64E693DBE4B7DFD44AB566C80186EAE764B4_inline(L_15, /*hidden argument*/NULL);
-			if (!((RuntimeObject*)IsInst((RuntimeObject*)L_16, IObjectReference_t6CDA6360AB0728B0A65C44CFEECA24F338134E80_il2cpp_TypeInfo_var)))
+			if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_16, IObjectReference_t6CDA6360AB0728B0A65C44CFEECA24F338134E80_il2cpp_TypeInfo_var)))
 			{
 				goto IL_0069;
 			}
@@ -20212,7 +20212,7 @@ IL_007d:
 IL_0092:
 	{
 		RuntimeObject * L_22 = ___obj0;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_22, IDeserializationCallback_t5C1534C9F1DCD3210770154062D21CBCC6F0E27A_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_22, IDeserializationCallback_t5C1534C9F1DCD3210770154062D21CBCC6F0E27A_il2cpp_TypeInfo_var)))
 		{
 			goto IL_00b6;
 		}
@@ -20422,7 +20422,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR void ObjectManager_CompleteISerializableObjec
 IL_000e:
 	{
 		RuntimeObject * L_2 = ___obj0;
-		if (((RuntimeObject*)IsInst((RuntimeObject*)L_2, ISerializable_t6367D17788BC3D11199A6922F5932FB0DB2F2815_il2cpp_TypeInfo_var)))
+		if (((RuntimeObject*)IsInstCached((RuntimeObject*)L_2, ISerializable_t6367D17788BC3D11199A6922F5932FB0DB2F2815_il2cpp_TypeInfo_var)))
 		{
 			goto IL_0026;
 		}
@@ -30729,7 +30729,7 @@ IL_01f4:
 		String_t* L_67 = ___name0;
 		int32_t L_68 = ___bindingFlags1;
 		MemberInfoU5BU5D_t6A57DDAF4E5321D22FB4C021559637EB126BF6B6* L_69 = VirtFuncInvoker3< MemberInfoU5BU5D_t6A57DDAF4E5321D22FB4C021559637EB126BF6B6*, String_t*, int32_t, int32_t >::Invoke(57 /* System.Reflection.MemberInfo[] System.Type::GetMember(System.String,System.Reflection.MemberTypes,System.Reflection.BindingFlags) */, __this, L_67, 4, L_68);
-		V_8 = ((FieldInfoU5BU5D_t9C36FA93372CA01DAF85946064B058CD9CE2E8BE*)IsInst((RuntimeObject*)L_69, FieldInfoU5BU5D_t9C36FA93372CA01DAF85946064B058CD9CE2E8BE_il2cpp_TypeInfo_var));
+		V_8 = ((FieldInfoU5BU5D_t9C36FA93372CA01DAF85946064B058CD9CE2E8BE*)IsInstCached((RuntimeObject*)L_69, FieldInfoU5BU5D_t9C36FA93372CA01DAF85946064B058CD9CE2E8BE_il2cpp_TypeInfo_var));
 		FieldInfoU5BU5D_t9C36FA93372CA01DAF85946064B058CD9CE2E8BE* L_70 = V_8;
 		NullCheck(L_70);
 		if ((!(((uint32_t)(((int32_t)((int32_t)(((RuntimeArray*)L_70)->max_length))))) == ((uint32_t)1))))
@@ -31096,7 +31096,7 @@ IL_03b3:
 		String_t* L_159 = ___name0;
 		int32_t L_160 = ___bindingFlags1;
 		MemberInfoU5BU5D_t6A57DDAF4E5321D22FB4C021559637EB126BF6B6* L_161 = VirtFuncInvoker3< MemberInfoU5BU5D_t6A57DDAF4E5321D22FB4C021559637EB126BF6B6*, String_t*, int32_t, int32_t >::Invoke(57 /* System.Reflection.MemberInfo[] System.Type::GetMember(System.String,System.Reflection.MemberTypes,System.Reflection.BindingFlags) */, __this, L_159, 8, L_160);
-		V_13 = ((MethodInfoU5BU5D_t93E968F23AF2DB5CFCFF13BE775A0E222C03586B*)IsInst((RuntimeObject*)L_161, MethodInfoU5BU5D_t93E968F23AF2DB5CFCFF13BE775A0E222C03586B_il2cpp_TypeInfo_var));
+		V_13 = ((MethodInfoU5BU5D_t93E968F23AF2DB5CFCFF13BE775A0E222C03586B*)IsInstCached((RuntimeObject*)L_161, MethodInfoU5BU5D_t93E968F23AF2DB5CFCFF13BE775A0E222C03586B_il2cpp_TypeInfo_var));
 		V_14 = (List_1_t8693F442D94ED2E09D894940915C961D2F63C69B *)NULL;
 		V_15 = 0;
 		goto IL_0431;
@@ -31213,7 +31213,7 @@ IL_0454:
 		String_t* L_194 = ___name0;
 		int32_t L_195 = ___bindingFlags1;
 		MemberInfoU5BU5D_t6A57DDAF4E5321D22FB4C021559637EB126BF6B6* L_196 = VirtFuncInvoker3< MemberInfoU5BU5D_t6A57DDAF4E5321D22FB4C021559637EB126BF6B6*, String_t*, int32_t, int32_t >::Invoke(57 /* System.Reflection.MemberInfo[] System.Type::GetMember(System.String,System.Reflection.MemberTypes,System.Reflection.BindingFlags) */, __this, L_194, ((int32_t)16), L_195);
-		V_17 = ((PropertyInfoU5BU5D_tAD8E99B12FF99CA4F2EA37B612DE68E112B4CF7E*)IsInst((RuntimeObject*)L_196, PropertyInfoU5BU5D_tAD8E99B12FF99CA4F2EA37B612DE68E112B4CF7E_il2cpp_TypeInfo_var));
+		V_17 = ((PropertyInfoU5BU5D_tAD8E99B12FF99CA4F2EA37B612DE68E112B4CF7E*)IsInstCached((RuntimeObject*)L_196, PropertyInfoU5BU5D_tAD8E99B12FF99CA4F2EA37B612DE68E112B4CF7E_il2cpp_TypeInfo_var));
 		V_18 = (List_1_t8693F442D94ED2E09D894940915C961D2F63C69B *)NULL;
 		V_19 = 0;
 		goto IL_04f9;
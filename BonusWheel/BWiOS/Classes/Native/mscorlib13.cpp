@@ -12793,7 +12793,7 @@ FINALLY_0051:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_15 = V_1;
-			V_3 = ((RuntimeObject*)IsInst((RuntimeObject*)L_15, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_3 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_15, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_16 = V_3;
 			if (!L_16)
 			{
@@ -13700,7 +13700,7 @@ FINALLY_014f:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_59 = V_2;
-			V_3 = ((RuntimeObject*)IsInst((RuntimeObject*)L_59, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_3 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_59, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_60 = V_3;
 			if (!L_60)
 			{
@@ -13834,7 +13834,7 @@ FINALLY_003e:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_12 = V_0;
-			V_3 = ((RuntimeObject*)IsInst((RuntimeObject*)L_12, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_3 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_12, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_13 = V_3;
 			if (!L_13)
 			{
@@ -26738,7 +26738,7 @@ IL_0010:
 IL_002d:
 	{
 		RuntimeObject * L_11 = ___x0;
-		V_1 = ((RuntimeObject*)IsInst((RuntimeObject*)L_11, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
+		V_1 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_11, IComparable_tF58875555EC83AB78FA9E958C48803C6AF9FB5D9_il2cpp_TypeInfo_var));
 		RuntimeObject* L_12 = V_1;
 		if (!L_12)
 		{
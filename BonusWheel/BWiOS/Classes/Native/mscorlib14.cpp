@@ -23610,7 +23610,7 @@ IL_027d:
 	}
 	{
 		RuntimeObject * L_144 = V_7;
-		V_12 = ((RuntimeObject*)IsInst((RuntimeObject*)L_144, IFormattable_t58E0883927AD7B9E881837942BD4FA2E7D8330C0_il2cpp_TypeInfo_var));
+		V_12 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_144, IFormattable_t58E0883927AD7B9E881837942BD4FA2E7D8330C0_il2cpp_TypeInfo_var));
 		RuntimeObject* L_145 = V_12;
 		if (!L_145)
 		{
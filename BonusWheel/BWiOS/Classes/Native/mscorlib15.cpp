@@ -35039,7 +35039,7 @@ IL_005d:
 IL_007b:
 	{
 		RuntimeObject * L_14 = V_0;
-		V_3 = ((RuntimeObject*)IsInst((RuntimeObject*)L_14, ITaskCompletionAction_tB83E2DB0F3297A73CDBE338B6F2CA81D84E9C978_il2cpp_TypeInfo_var));
+		V_3 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_14, ITaskCompletionAction_tB83E2DB0F3297A73CDBE338B6F2CA81D84E9C978_il2cpp_TypeInfo_var));
 		RuntimeObject* L_15 = V_3;
 		if (!L_15)
 		{
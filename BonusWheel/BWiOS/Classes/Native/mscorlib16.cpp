@@ -14533,7 +14533,7 @@ IL_0034:
 IL_0047:
 	{
 		RuntimeObject * L_13 = ___exceptionObject0;
-		V_3 = ((RuntimeObject*)IsInst((RuntimeObject*)L_13, IEnumerable_1_t6B3D33CE5B4DC884E5267C7B8CBC12380D09B3F1_il2cpp_TypeInfo_var));
+		V_3 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_13, IEnumerable_1_t6B3D33CE5B4DC884E5267C7B8CBC12380D09B3F1_il2cpp_TypeInfo_var));
 		RuntimeObject* L_14 = V_3;
 		if (!L_14)
 		{
@@ -14620,7 +14620,7 @@ IL_0087:
 IL_0088:
 	{
 		RuntimeObject * L_26 = ___exceptionObject0;
-		V_6 = ((RuntimeObject*)IsInst((RuntimeObject*)L_26, IEnumerable_1_t37B4D1EEBA6E5098A0F018A779067097451BAD2C_il2cpp_TypeInfo_var));
+		V_6 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_26, IEnumerable_1_t37B4D1EEBA6E5098A0F018A779067097451BAD2C_il2cpp_TypeInfo_var));
 		RuntimeObject* L_27 = V_6;
 		if (!L_27)
 		{
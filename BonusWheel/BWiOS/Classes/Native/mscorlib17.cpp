@@ -9553,7 +9553,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR bool ATypeName_Equals_mCADC0D866B2E78D4BA5634
 	}
 	{
 		RuntimeObject * L_0 = ___other0;
-		bool L_1 = ATypeName_Equals_m7D88938E443BA9FAEA8615EEFBAE8E23B1BE6BD2(__this, ((RuntimeObject*)IsInst((RuntimeObject*)L_0, TypeName_t0C63929669D92B034691B7E78AF79FA1F8592513_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
+		bool L_1 = ATypeName_Equals_m7D88938E443BA9FAEA8615EEFBAE8E23B1BE6BD2(__this, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, TypeName_t0C63929669D92B034691B7E78AF79FA1F8592513_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
 		return L_1;
 	}
 }
@@ -15075,7 +15075,7 @@ IL_002f:
 		Type_t * L_18 = Type_GetTypeFromHandle_m9DC58ADF0512987012A8A016FB64B068F3B1AFF6(L_17, /*hidden argument*/NULL);
 		NullCheck(L_16);
 		RuntimeObject * L_19 = SerializationInfo_GetValue_m7910CE6C68888C1F863D7A35915391FA33463ECF(L_16, _stringLiteralD98E4C3E01D3ED0C6FD51F3FF6F8A3C9CA9223C3, L_18, /*hidden argument*/NULL);
-		__this->set_m_elementTypes_1(((Int32U5BU5D_t2B9E4FDDDB9F0A00EC0AC631BA2DA915EB1ECF83*)IsInst((RuntimeObject*)L_19, Int32U5BU5D_t2B9E4FDDDB9F0A00EC0AC631BA2DA915EB1ECF83_il2cpp_TypeInfo_var)));
+		__this->set_m_elementTypes_1(((Int32U5BU5D_t2B9E4FDDDB9F0A00EC0AC631BA2DA915EB1ECF83*)IsInstCached((RuntimeObject*)L_19, Int32U5BU5D_t2B9E4FDDDB9F0A00EC0AC631BA2DA915EB1ECF83_il2cpp_TypeInfo_var)));
 		return;
 	}
 
@@ -15094,13 +15094,13 @@ IL_00aa:
 		Type_t * L_23 = Type_GetTypeFromHandle_m9DC58ADF0512987012A8A016FB64B068F3B1AFF6(L_22, /*hidden argument*/NULL);
 		NullCheck(L_21);
 		RuntimeObject * L_24 = SerializationInfo_GetValue_m7910CE6C68888C1F863D7A35915391FA33463ECF(L_21, _stringLiteralF221811315A6A4EB975642C56E41ECFB1B78BF7A, L_23, /*hidden argument*/NULL);
-		__this->set_m_instantiation_0(((TypeU5BU5D_t7FE623A666B49176DE123306221193E888A12F5F*)IsInst((RuntimeObject*)L_24, TypeU5BU5D_t7FE623A666B49176DE123306221193E888A12F5F_il2cpp_TypeInfo_var)));
+		__this->set_m_instantiation_0(((TypeU5BU5D_t7FE623A666B49176DE123306221193E888A12F5F*)IsInstCached((RuntimeObject*)L_24, TypeU5BU5D_t7FE623A666B49176DE123306221193E888A12F5F_il2cpp_TypeInfo_var)));
 		SerializationInfo_t1BB80E9C9DEA52DBF464487234B045E2930ADA26 * L_25 = ___info0;
 		RuntimeTypeHandle_t7B542280A22F0EC4EAC2061C29178845847A8B2D  L_26 = { reinterpret_cast<intptr_t> (Int32U5BU5D_t2B9E4FDDDB9F0A00EC0AC631BA2DA915EB1ECF83_0_0_0_var) };
 		Type_t * L_27 = Type_GetTypeFromHandle_m9DC58ADF0512987012A8A016FB64B068F3B1AFF6(L_26, /*hidden argument*/NULL);
 		NullCheck(L_25);
 		RuntimeObject * L_28 = SerializationInfo_GetValue_m7910CE6C68888C1F863D7A35915391FA33463ECF(L_25, _stringLiteralD98E4C3E01D3ED0C6FD51F3FF6F8A3C9CA9223C3, L_27, /*hidden argument*/NULL);
-		__this->set_m_elementTypes_1(((Int32U5BU5D_t2B9E4FDDDB9F0A00EC0AC631BA2DA915EB1ECF83*)IsInst((RuntimeObject*)L_28, Int32U5BU5D_t2B9E4FDDDB9F0A00EC0AC631BA2DA915EB1ECF83_il2cpp_TypeInfo_var)));
+		__this->set_m_elementTypes_1(((Int32U5BU5D_t2B9E4FDDDB9F0A00EC0AC631BA2DA915EB1ECF83*)IsInstCached((RuntimeObject*)L_28, Int32U5BU5D_t2B9E4FDDDB9F0A00EC0AC631BA2DA915EB1ECF83_il2cpp_TypeInfo_var)));
 	}
 
 IL_00f3:
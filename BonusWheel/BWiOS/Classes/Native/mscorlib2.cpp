@@ -12151,7 +12151,7 @@ IL_0060:
 	{
 		V_0 = 0;
 		RuntimeArray * L_15 = ___array0;
-		if (!((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInst((RuntimeObject*)L_15, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var)))
+		if (!((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInstCached((RuntimeObject*)L_15, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var)))
 		{
 			goto IL_00b5;
 		}
@@ -14310,7 +14310,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR int32_t Convert_GetTypeCode_mFE36252E332A7D69
 IL_0005:
 	{
 		RuntimeObject * L_1 = ___value0;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_1, IConvertible_tB52671A602A64FCCFD27EA5817E2A6C2B693D380_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_1, IConvertible_tB52671A602A64FCCFD27EA5817E2A6C2B693D380_il2cpp_TypeInfo_var));
 		RuntimeObject* L_2 = V_0;
 		if (!L_2)
 		{
@@ -14376,7 +14376,7 @@ IL_000f:
 IL_0011:
 	{
 		RuntimeObject * L_4 = ___value0;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_4, IConvertible_tB52671A602A64FCCFD27EA5817E2A6C2B693D380_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_4, IConvertible_tB52671A602A64FCCFD27EA5817E2A6C2B693D380_il2cpp_TypeInfo_var));
 		RuntimeObject* L_5 = V_0;
 		if (L_5)
 		{
@@ -15261,7 +15261,7 @@ IL_002f:
 IL_0031:
 	{
 		RuntimeObject * L_8 = ___value0;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_8, IConvertible_tB52671A602A64FCCFD27EA5817E2A6C2B693D380_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_8, IConvertible_tB52671A602A64FCCFD27EA5817E2A6C2B693D380_il2cpp_TypeInfo_var));
 		RuntimeObject* L_9 = V_0;
 		if (L_9)
 		{
@@ -19474,7 +19474,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR String_t* Convert_ToString_m10FC2E5535B944C2D
 	RuntimeObject* V_1 = NULL;
 	{
 		RuntimeObject * L_0 = ___value0;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_0, IConvertible_tB52671A602A64FCCFD27EA5817E2A6C2B693D380_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, IConvertible_tB52671A602A64FCCFD27EA5817E2A6C2B693D380_il2cpp_TypeInfo_var));
 		RuntimeObject* L_1 = V_0;
 		if (!L_1)
 		{
@@ -19492,7 +19492,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR String_t* Convert_ToString_m10FC2E5535B944C2D
 IL_0012:
 	{
 		RuntimeObject * L_5 = ___value0;
-		V_1 = ((RuntimeObject*)IsInst((RuntimeObject*)L_5, IFormattable_t58E0883927AD7B9E881837942BD4FA2E7D8330C0_il2cpp_TypeInfo_var));
+		V_1 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_5, IFormattable_t58E0883927AD7B9E881837942BD4FA2E7D8330C0_il2cpp_TypeInfo_var));
 		RuntimeObject* L_6 = V_1;
 		if (!L_6)
 		{
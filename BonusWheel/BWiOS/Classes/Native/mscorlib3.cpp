@@ -39521,7 +39521,7 @@ IL_002b:
 	{
 		RuntimeObject ** L_7 = ___data0;
 		RuntimeObject * L_8 = *((RuntimeObject **)L_7);
-		ByteU5BU5D_tD06FDBE8142446525DF1C40351D523A228373821* L_9 = ((ByteU5BU5D_tD06FDBE8142446525DF1C40351D523A228373821*)IsInst((RuntimeObject*)L_8, ByteU5BU5D_tD06FDBE8142446525DF1C40351D523A228373821_il2cpp_TypeInfo_var));
+		ByteU5BU5D_tD06FDBE8142446525DF1C40351D523A228373821* L_9 = ((ByteU5BU5D_tD06FDBE8142446525DF1C40351D523A228373821*)IsInstCached((RuntimeObject*)L_8, ByteU5BU5D_tD06FDBE8142446525DF1C40351D523A228373821_il2cpp_TypeInfo_var));
 		V_1 = L_9;
 		if (!L_9)
 		{
@@ -31712,7 +31712,7 @@ IL_01ba:
 		NullCheck(L_104);
 		int32_t L_105 = List_1_get_Count_m507C9149FF7F83AAC72C29091E745D557DA47D22_inline(L_104, /*hidden argument*/List_1_get_Count_m507C9149FF7F83AAC72C29091E745D557DA47D22_RuntimeMethod_var);
 		RuntimeArray * L_106 = Array_CreateInstance_mE3FF1559BCD06302A7DA79FCE32232941AC38F3F(L_103, L_105, /*hidden argument*/NULL);
-		V_5 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInst((RuntimeObject*)L_106, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
+		V_5 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInstCached((RuntimeObject*)L_106, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
 	}
 
 IL_01cd:
@@ -31988,7 +31988,7 @@ IL_02e7:
 		NullCheck(L_173);
 		int32_t L_174 = List_1_get_Count_m507C9149FF7F83AAC72C29091E745D557DA47D22_inline(L_173, /*hidden argument*/List_1_get_Count_m507C9149FF7F83AAC72C29091E745D557DA47D22_RuntimeMethod_var);
 		RuntimeArray * L_175 = Array_CreateInstance_mE3FF1559BCD06302A7DA79FCE32232941AC38F3F(L_172, L_174, /*hidden argument*/NULL);
-		V_5 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInst((RuntimeObject*)L_175, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
+		V_5 = ((ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A*)IsInstCached((RuntimeObject*)L_175, ObjectU5BU5D_t3C9242B5C88A48B2A5BD9FDA6CD0024E792AF08A_il2cpp_TypeInfo_var));
 	}
 
 IL_02fa:
@@ -35789,7 +35789,7 @@ IL_002e:
 IL_0035:
 	{
 		RuntimeObject* L_12 = V_0;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_12, IConstructionReturnMessage_tD78C6B12128C5D713E531737E203DDB7CC447B2B_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_12, IConstructionReturnMessage_tD78C6B12128C5D713E531737E203DDB7CC447B2B_il2cpp_TypeInfo_var)))
 		{
 			goto IL_0060;
 		}
@@ -36037,7 +36037,7 @@ FINALLY_008b:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_31 = V_5;
-			V_6 = ((RuntimeObject*)IsInst((RuntimeObject*)L_31, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_6 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_31, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_32 = V_6;
 			if (!L_32)
 			{
@@ -36082,7 +36082,7 @@ IL_00ae:
 		RuntimeObject * L_39 = (L_36)->GetAt(static_cast<il2cpp_array_size_t>(L_38));
 		V_9 = L_39;
 		RuntimeObject * L_40 = V_9;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_40, IContextAttribute_t79D0ADC6F379C29D95950D6B8348D6DA4A356BD5_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_40, IContextAttribute_t79D0ADC6F379C29D95950D6B8348D6DA4A356BD5_il2cpp_TypeInfo_var)))
 		{
 			goto IL_00dd;
 		}
@@ -36197,7 +36197,7 @@ FINALLY_0121:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_62 = V_5;
-			V_6 = ((RuntimeObject*)IsInst((RuntimeObject*)L_62, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_6 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_62, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_63 = V_6;
 			if (!L_63)
 			{
@@ -37008,7 +37008,7 @@ FINALLY_00a9:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_27 = V_0;
-			V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_27, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_27, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_28 = V_2;
 			if (!L_28)
 			{
@@ -37112,7 +37112,7 @@ FINALLY_010d:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_45 = V_3;
-			V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_45, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_45, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_46 = V_2;
 			if (!L_46)
 			{
@@ -37216,7 +37216,7 @@ FINALLY_0171:
 	{ // begin finally (depth: 1)
 		{
 			RuntimeObject* L_63 = V_3;
-			V_2 = ((RuntimeObject*)IsInst((RuntimeObject*)L_63, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+			V_2 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_63, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 			RuntimeObject* L_64 = V_2;
 			if (!L_64)
 			{
@@ -37567,7 +37567,7 @@ IL_0029:
 				RuntimeObject* L_6 = V_3;
 				NullCheck(L_6);
 				RuntimeObject * L_7 = InterfaceFuncInvoker0< RuntimeObject * >::Invoke(1 /* System.Object System.Collections.IEnumerator::get_Current() */, IEnumerator_t8789118187258CC88B77AFAC6315B5AF87D3E18A_il2cpp_TypeInfo_var, L_6);
-				V_4 = ((RuntimeObject*)IsInst((RuntimeObject*)((RuntimeObject*)Castclass((RuntimeObject*)L_7, IChannel_tD8FFD1687DF38D9F030BFC6424B07B3C7B435DAF_il2cpp_TypeInfo_var)), IChannelSender_t40A5121737C3D5C041BD9EECC5579E2DB3061073_il2cpp_TypeInfo_var));
+				V_4 = ((RuntimeObject*)IsInstCached((RuntimeObject*)((RuntimeObject*)Castclass((RuntimeObject*)L_7, IChannel_tD8FFD1687DF38D9F030BFC6424B07B3C7B435DAF_il2cpp_TypeInfo_var)), IChannelSender_t40A5121737C3D5C041BD9EECC5579E2DB3061073_il2cpp_TypeInfo_var));
 				RuntimeObject* L_8 = V_4;
 				if (!L_8)
 				{
@@ -37624,7 +37624,7 @@ FINALLY_0062:
 		{ // begin finally (depth: 2)
 			{
 				RuntimeObject* L_18 = V_3;
-				V_7 = ((RuntimeObject*)IsInst((RuntimeObject*)L_18, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+				V_7 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_18, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 				RuntimeObject* L_19 = V_7;
 				if (!L_19)
 				{
@@ -37729,7 +37729,7 @@ FINALLY_00c8:
 		{ // begin finally (depth: 2)
 			{
 				RuntimeObject* L_37 = V_3;
-				V_7 = ((RuntimeObject*)IsInst((RuntimeObject*)L_37, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+				V_7 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_37, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 				RuntimeObject* L_38 = V_7;
 				if (!L_38)
 				{
@@ -37853,7 +37853,7 @@ IL_0016:
 		RuntimeObject * L_10 = (L_7)->GetAt(static_cast<il2cpp_array_size_t>(L_9));
 		V_2 = L_10;
 		RuntimeObject * L_11 = V_2;
-		if (!((RuntimeObject*)IsInst((RuntimeObject*)L_11, IChannelDataStore_t54817EF23BF82784E63C934E4A90ADD04AA13287_il2cpp_TypeInfo_var)))
+		if (!((RuntimeObject*)IsInstCached((RuntimeObject*)L_11, IChannelDataStore_t54817EF23BF82784E63C934E4A90ADD04AA13287_il2cpp_TypeInfo_var)))
 		{
 			goto IL_002e;
 		}
@@ -37975,7 +37975,7 @@ IL_000e:
 	}
 	{
 		RuntimeObject* L_3 = ___chnl0;
-		RuntimeObject* L_4 = ((RuntimeObject*)IsInst((RuntimeObject*)L_3, ISecurableChannel_t92217B41292332857147A6ED7064E9537C361DFB_il2cpp_TypeInfo_var));
+		RuntimeObject* L_4 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_3, ISecurableChannel_t92217B41292332857147A6ED7064E9537C361DFB_il2cpp_TypeInfo_var));
 		G_B4_0 = L_4;
 		if (L_4)
 		{
@@ -38144,7 +38144,7 @@ IL_00e3:
 IL_00ef:
 		{
 			RuntimeObject* L_43 = ___chnl0;
-			V_3 = ((RuntimeObject*)IsInst((RuntimeObject*)L_43, IChannelReceiver_t625F425D65038B77730E6F2ED3BB1C8FDADBF181_il2cpp_TypeInfo_var));
+			V_3 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_43, IChannelReceiver_t625F425D65038B77730E6F2ED3BB1C8FDADBF181_il2cpp_TypeInfo_var));
 			RuntimeObject* L_44 = V_3;
 			if (!L_44)
 			{
@@ -38586,7 +38586,7 @@ IL_0200:
 IL_021b:
 		{
 			RuntimeObject* L_110 = V_8;
-			if (((RuntimeObject*)IsInst((RuntimeObject*)L_110, IChannelReceiver_t625F425D65038B77730E6F2ED3BB1C8FDADBF181_il2cpp_TypeInfo_var)))
+			if (((RuntimeObject*)IsInstCached((RuntimeObject*)L_110, IChannelReceiver_t625F425D65038B77730E6F2ED3BB1C8FDADBF181_il2cpp_TypeInfo_var)))
 			{
 				goto IL_0233;
 			}
@@ -38887,7 +38887,7 @@ IL2CPP_EXTERN_C IL2CPP_METHOD_ATTR RuntimeObject* ChannelServices_CheckReturnMes
 	RuntimeObject* V_0 = NULL;
 	{
 		RuntimeObject* L_0 = ___retMsg1;
-		V_0 = ((RuntimeObject*)IsInst((RuntimeObject*)L_0, IMethodReturnMessage_tF73EC49214910CFE7305EF5891608B3556D273BF_il2cpp_TypeInfo_var));
+		V_0 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_0, IMethodReturnMessage_tF73EC49214910CFE7305EF5891608B3556D273BF_il2cpp_TypeInfo_var));
 		RuntimeObject* L_1 = V_0;
 		if (!L_1)
 		{
@@ -38996,7 +38996,7 @@ IL_0028:
 				RuntimeObject* L_6 = V_3;
 				NullCheck(L_6);
 				RuntimeObject * L_7 = InterfaceFuncInvoker0< RuntimeObject * >::Invoke(1 /* System.Object System.Collections.IEnumerator::get_Current() */, IEnumerator_t8789118187258CC88B77AFAC6315B5AF87D3E18A_il2cpp_TypeInfo_var, L_6);
-				V_4 = ((RuntimeObject*)IsInst((RuntimeObject*)L_7, IChannelReceiver_t625F425D65038B77730E6F2ED3BB1C8FDADBF181_il2cpp_TypeInfo_var));
+				V_4 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_7, IChannelReceiver_t625F425D65038B77730E6F2ED3BB1C8FDADBF181_il2cpp_TypeInfo_var));
 				RuntimeObject* L_8 = V_4;
 				if (!L_8)
 				{
@@ -39051,7 +39051,7 @@ FINALLY_0058:
 		{ // begin finally (depth: 2)
 			{
 				RuntimeObject* L_16 = V_3;
-				V_6 = ((RuntimeObject*)IsInst((RuntimeObject*)L_16, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
+				V_6 = ((RuntimeObject*)IsInstCached((RuntimeObject*)L_16, IDisposable_t7218B22548186B208D65EA5B7870503810A2D15A_il2cpp_TypeInfo_var));
 				RuntimeObject* L_17 = V_6;
 				if (!L_17)
 				{
@@ -39750,7 +39750,7 @@ IL_0067:
 			MemoryStream_t495F44B85E6B4DDE2BB7E17DE963256A74E2298C * L_21 = (MemoryStream_t495F44B85E6B4DDE2BB7E17DE963256A74E2298C *)il2cpp_codegen_object_new(MemoryStream_t495F44B85E6B4DDE2BB7E17DE963256A74E2298C_il2cpp_TypeInfo_var);
 			MemoryStream__ctor_m731754F1435D29F87C407D84ED47AF35FFF9B0EF(L_21, L_20, /*hidden argument*/NULL);
 			RuntimeObject* L_22 = ___msgRequest0;
-			RuntimeObject* L_23 = CADSerializer_DeserializeMessage_m9EA9A8A2521F4DE96FFFE8217E3F9509EF752276(L_21, ((RuntimeObject*)IsInst((RuntimeObject*)L_22, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
+			RuntimeObject* L_23 = CADSerializer_DeserializeMessage_m9EA9A8A2521F4DE96FFFE8217E3F9509EF752276(L_21, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_22, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
 			V_0 = L_23;
 			goto IL_0088;
 		}
@@ -39760,7 +39760,7 @@ IL_007b:
 			RuntimeObject* L_24 = ___msgRequest0;
 			CADMethodReturnMessage_tC46DD1930F6C9F9EF55AAEBD5F3C638BD9FE823C * L_25 = V_3;
 			MethodResponse_t185820C6B3E7D56E9026084CB2CEF1387151D907 * L_26 = (MethodResponse_t185820C6B3E7D56E9026084CB2CEF1387151D907 *)il2cpp_codegen_object_new(MethodResponse_t185820C6B3E7D56E9026084CB2CEF1387151D907_il2cpp_TypeInfo_var);
-			MethodResponse__ctor_m839FF8EAB4D06067825F228C91F90C69464A77A6(L_26, ((RuntimeObject*)IsInst((RuntimeObject*)L_24, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), L_25, /*hidden argument*/NULL);
+			MethodResponse__ctor_m839FF8EAB4D06067825F228C91F90C69464A77A6(L_26, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_24, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), L_25, /*hidden argument*/NULL);
 			V_0 = L_26;
 		}
 
@@ -39789,7 +39789,7 @@ IL_008c:
 			Exception_t * L_27 = V_6;
 			RuntimeObject* L_28 = ___msgRequest0;
 			ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03 * L_29 = (ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03 *)il2cpp_codegen_object_new(ReturnMessage_tCB42BAB06521388D0FC8E5745FC9A74FCC4E6E03_il2cpp_TypeInfo_var);
-			ReturnMessage__ctor_mA17F87483A741789E4E5CAF7D3A1F8DCF32CB57E(L_29, L_27, ((RuntimeObject*)IsInst((RuntimeObject*)L_28, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
+			ReturnMessage__ctor_mA17F87483A741789E4E5CAF7D3A1F8DCF32CB57E(L_29, L_27, ((RuntimeObject*)IsInstCached((RuntimeObject*)L_28, IMethodCallMessage_t9A3B0B9D1DCB71D44BB799FD5CA1100C4824C386_il2cpp_TypeInfo_var)), /*hidden argument*/NULL);
 			V_0 = L_29;
 			goto IL_009f;
 		} // end try (depth: 2)
@@ -8,9 +8,11 @@
 #include "utils/RegisterRuntimeInitializeAndCleanup.h"
 
 #include "vm/Atomic.h"
+#include "vm/CastCache.h"
 #include "vm/ClassInlines.h"
 #include "vm/ScopedThreadAttacher.h"
 #include "vm/String.h"
+#include "vm-utils/NativeDelegateFastLookup.h"
 
 #if IL2CPP_ENABLE_PROFILER
 
@@ -175,6 +177,31 @@ inline RuntimeObject* IsInstClass(RuntimeObject *obj, RuntimeClass* targetType)
     return il2cpp::vm::ClassInlines::HasParentUnsafe(obj->klass, targetType) ? obj : NULL;
 }
 
+// Interfaces, variant generics and arrays: the answer for a given (class, target) pair is
+// remembered in vm::CastCache so only the first cast takes the IsAssignableFrom path.
+// IsInst itself is defined in the prebuilt runtime, so the generated isinst/as sites in
+// Classes/Native call this instead, as do Castclass and the array store check. Code that
+// IL2CPP generates again calls IsInst, and has to be pointed here again.
+inline RuntimeObject* IsInstCached(RuntimeObject *obj, RuntimeClass* targetType)
+{
+    if (!obj)
+        return NULL;
+
+    switch (il2cpp::vm::CastCache::Lookup(obj->klass, targetType))
+    {
+        case il2cpp::vm::CastCache::kAssignable:
+            return obj;
+        case il2cpp::vm::CastCache::kNotAssignable:
+            return NULL;
+        default:
+            break;
+    }
+
+    RuntimeObject* result = IsInst(obj, targetType);
+    il2cpp::vm::CastCache::Store(obj->klass, targetType, result != NULL);
+    return result;
+}
+
 // OpCode.Castclass
 
 NORETURN void RaiseInvalidCastException(RuntimeObject* obj, RuntimeClass* targetType);
@@ -184,7 +211,7 @@ inline RuntimeObject* Castclass(RuntimeObject *obj, RuntimeClass* targetType)
     if (!obj)
         return NULL;
 
-    RuntimeObject* result = IsInst(obj, targetType);
+    RuntimeObject* result = IsInstCached(obj, targetType);
     if (result)
         return result;
 
@@ -502,7 +529,7 @@ Il2CppDelegate* il2cpp_codegen_marshal_function_ptr_to_delegate_internal(void* f
 template<typename T>
 inline T* il2cpp_codegen_marshal_function_ptr_to_delegate(Il2CppMethodPointer functionPtr, RuntimeClass* delegateType)
 {
-    return (T*)il2cpp_codegen_marshal_function_ptr_to_delegate_internal(reinterpret_cast<void*>(functionPtr), delegateType);
+    return (T*)il2cpp::utils::NativeDelegateFastLookup::MarshalFunctionPointerToDelegate(reinterpret_cast<void*>(functionPtr), delegateType);
 }
 
 void il2cpp_codegen_marshal_store_last_error();
@@ -587,7 +614,7 @@ void il2cpp_codegen_runtime_class_init(RuntimeClass* klass);
 inline void ArrayElementTypeCheck(RuntimeArray* array, void* value)
 {
 #if !IL2CPP_TINY
-    if (value != NULL && IsInst((RuntimeObject*)value, array->klass->element_class) == NULL)
+    if (value != NULL && IsInstCached((RuntimeObject*)value, array->klass->element_class) == NULL)
         il2cpp_codegen_raise_exception(il2cpp_codegen_get_array_type_mismatch_exception());
 #endif
 }
@@ -0,0 +1,317 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "gc/GarbageCollector.h"
+#include "gc/GCHandle.h"
+#include "os/CleanupThreadLocalValue.h"
+#include "os/Mutex.h"
+#include "os/Unity/UnityPlatformConfigure.h"
+#include "os/Unity/ExtendedAtomicOps.h"
+#include "utils/Memory.h"
+#include <string.h>
+#include <vector>
+
+namespace il2cpp
+{
+namespace gc
+{
+/// Slab allocated GC handle table for high churn native <-> managed links.
+///
+/// Handles are encoded like GCHandle's, (slot index << 3) | (type + 1), with the top bit
+/// (kTableTag) set on top. GCHandle never sets that bit: it would need 2^28 live handles of
+/// one type to reach it, and this table's indices stop below 2^21. A handle still has to be
+/// resolved and freed by the class that created it; OwnsHandle tells the two apart for
+/// callers that hold handles of either kind, and GetTarget and Free assert that they were
+/// given one of theirs. The tagged handles mean nothing to the runtime either, so they
+/// cannot be stored in a managed System.Runtime.InteropServices.GCHandle or passed to the
+/// il2cpp_gchandle_* API; native code that hands a handle to managed code still needs a
+/// GCHandle.
+///
+/// Each handle type has a directory of fixed size slabs that are allocated on demand and
+/// never freed; a slab pointer is published with release semantics, so GetTarget on a
+/// strong handle is two loads and never takes a lock. Strong slabs are allocated with
+/// GarbageCollector::AllocateFixed and are scanned as roots. Weak slabs live in malloc'd
+/// memory and their slots are registered as weak links, which the GC has to be asked to
+/// reveal: GetTarget on a weak handle goes through GarbageCollector::GetWeakLink and takes
+/// the GC lock, like GCHandle's.
+///
+/// Free slot indices are handed out from a small per-thread cache that is refilled from
+/// and spilled to a per-type global list kThreadCacheBatch at a time, so New and Free
+/// take the table mutex once every few dozen calls and never take the GC lock for
+/// strong handles. When a thread exits, its cached indices go back to the global lists
+/// and the cache is freed, where os::CleanupThreadLocalValue supports that (pthreads);
+/// elsewhere they are leaked with the cache.
+    class GCHandleTable
+    {
+    public:
+        static const uint32_t kSlotsPerSlab = 1024;
+        static const uint32_t kMaxSlabs = 2048;
+        static const uint32_t kTableTag = 0x80000000;
+
+        /// True for handles created here, false for GCHandle's.
+        static IL2CPP_FORCE_INLINE bool OwnsHandle(uint32_t handle)
+        {
+            return (handle & kTableTag) != 0;
+        }
+
+        static uint32_t New(Il2CppObject* obj, bool pinned)
+        {
+            return Allocate(pinned ? HANDLE_PINNED : HANDLE_NORMAL, obj);
+        }
+
+        static uint32_t NewWeakref(Il2CppObject* obj, bool trackResurrection)
+        {
+            return Allocate(trackResurrection ? HANDLE_WEAK_TRACK : HANDLE_WEAK, obj);
+        }
+
+        static GCHandleType GetHandleType(uint32_t handle)
+        {
+            return (GCHandleType)((handle & kTypeMask) - 1);
+        }
+
+        static Il2CppObject* GetTarget(uint32_t handle)
+        {
+            IL2CPP_ASSERT(handle == 0 || OwnsHandle(handle));
+            if (!OwnsHandle(handle))
+                return NULL;
+
+            uint32_t type = GetHandleType(handle);
+            if (type > HANDLE_PINNED)
+                return NULL;
+
+            void** slot = GetSlot(type, GetIndex(handle));
+            if (slot == NULL)
+                return NULL;
+
+            if (IsWeak(type))
+                return GarbageCollector::GetWeakLink(slot);
+            return static_cast<Il2CppObject*>(*reinterpret_cast<void* volatile*>(slot));
+        }
+
+        static void Free(uint32_t handle)
+        {
+            IL2CPP_ASSERT(handle == 0 || OwnsHandle(handle));
+            if (!OwnsHandle(handle))
+                return;
+
+            uint32_t type = GetHandleType(handle);
+            if (type > HANDLE_PINNED)
+                return;
+
+            uint32_t index = GetIndex(handle);
+            void** slot = GetSlot(type, index);
+            if (slot == NULL)
+                return;
+
+            if (IsWeak(type))
+                GarbageCollector::RemoveWeakLink(slot);
+            *slot = NULL;
+
+            ReleaseIndex(type, index);
+        }
+
+        /// Same contract as GCHandle::WalkStrongGCHandleTargets, for handles of this table.
+        static void WalkStrongGCHandleTargets(GCHandle::WalkGCHandleTargetsCallback callback, void* context)
+        {
+            const uint32_t strongTypes[] = { HANDLE_NORMAL, HANDLE_PINNED };
+            for (size_t i = 0; i < sizeof(strongTypes) / sizeof(strongTypes[0]); i++)
+            {
+                uint32_t type = strongTypes[i];
+                for (uint32_t slabIndex = 0; slabIndex < kMaxSlabs; slabIndex++)
+                {
+                    void** slab = LoadSlab(type, slabIndex);
+                    if (slab == NULL)
+                        break;
+
+                    for (uint32_t slot = 0; slot < kSlotsPerSlab; slot++)
+                    {
+                        if (slab[slot] != NULL)
+                            callback(static_cast<Il2CppObject*>(slab[slot]), context);
+                    }
+                }
+            }
+        }
+
+    private:
+        static const uint32_t kTypeBits = 3;
+        static const uint32_t kTypeMask = (1 << kTypeBits) - 1;
+        static const uint32_t kTypeCount = HANDLE_PINNED + 1;
+        static const uint32_t kSlabShift = 10;
+        static const uint32_t kThreadCacheBatch = 32;
+        static const uint32_t kThreadCacheCapacity = 2 * kThreadCacheBatch;
+
+        struct ThreadCache
+        {
+            uint32_t count[kTypeCount];
+            uint32_t indices[kTypeCount][kThreadCacheCapacity];
+        };
+
+        struct TypeState
+        {
+            il2cpp::os::FastMutex mutex;
+            std::vector<uint32_t> freeIndices;
+            uint32_t slabCount;
+
+            TypeState() : slabCount(0) {}
+        };
+
+        struct State
+        {
+            TypeState types[kTypeCount];
+            il2cpp::os::CleanupThreadLocalValue threadCache;
+
+            State() : threadCache(ReleaseThreadCache) {}
+        };
+
+        static IL2CPP_FORCE_INLINE uint32_t GetIndex(uint32_t handle)
+        {
+            return (handle & ~kTableTag) >> kTypeBits;
+        }
+
+        static IL2CPP_FORCE_INLINE bool IsWeak(uint32_t type)
+        {
+            return type == HANDLE_WEAK || type == HANDLE_WEAK_TRACK;
+        }
+
+        static IL2CPP_FORCE_INLINE void* volatile* GetSlabDirectory(uint32_t type)
+        {
+            // Zero initialized static storage, so GetTarget does not go through an initialization guard.
+            static void* volatile s_Slabs[kTypeCount][kMaxSlabs];
+            return s_Slabs[type];
+        }
+
+        static IL2CPP_FORCE_INLINE void** LoadSlab(uint32_t type, uint32_t slabIndex)
+        {
+            return (void**)il2cpp::os::atomic_load_explicit(reinterpret_cast<const volatile atomic_word*>(&GetSlabDirectory(type)[slabIndex]), il2cpp::os::memory_order_acquire);
+        }
+
+        static IL2CPP_FORCE_INLINE void** GetSlot(uint32_t type, uint32_t index)
+        {
+            uint32_t slabIndex = index >> kSlabShift;
+            if (slabIndex >= kMaxSlabs)
+                return NULL;
+
+            void** slab = LoadSlab(type, slabIndex);
+            return slab != NULL ? &slab[index & (kSlotsPerSlab - 1)] : NULL;
+        }
+
+        // Never destroyed: threads can still exit and release their caches during static destruction.
+        static State& GetState()
+        {
+            static State* s_State = new State();
+            return *s_State;
+        }
+
+        static ThreadCache* GetThreadCache()
+        {
+            State& state = GetState();
+
+            void* value = NULL;
+            state.threadCache.GetValue(&value);
+            if (value != NULL)
+                return static_cast<ThreadCache*>(value);
+
+            ThreadCache* cache = static_cast<ThreadCache*>(IL2CPP_MALLOC_ZERO(sizeof(ThreadCache)));
+            state.threadCache.SetValue(cache);
+            return cache;
+        }
+
+        static void ReleaseThreadCache(void* value)
+        {
+            ThreadCache* cache = static_cast<ThreadCache*>(value);
+            for (uint32_t type = 0; type < kTypeCount; type++)
+            {
+                if (cache->count[type] == 0)
+                    continue;
+
+                TypeState& typeState = GetState().types[type];
+                il2cpp::os::FastAutoLock lock(&typeState.mutex);
+                typeState.freeIndices.insert(typeState.freeIndices.end(), &cache->indices[type][0], &cache->indices[type][0] + cache->count[type]);
+            }
+            IL2CPP_FREE(cache);
+        }
+
+        static uint32_t Allocate(uint32_t type, Il2CppObject* obj)
+        {
+            ThreadCache* cache = GetThreadCache();
+            if (cache->count[type] == 0 && !Refill(type, cache))
+                return 0;
+
+            uint32_t index = cache->indices[type][--cache->count[type]];
+            void** slot = GetSlot(type, index);
+
+            if (IsWeak(type))
+            {
+                if (obj != NULL)
+                    GarbageCollector::AddWeakLink(slot, obj, type == HANDLE_WEAK_TRACK);
+            }
+            else
+            {
+                *slot = obj;
+                GarbageCollector::SetWriteBarrier(slot);
+            }
+
+            uint32_t handle = (index << kTypeBits) | (type + 1);
+            IL2CPP_ASSERT((handle & kTableTag) == 0);
+            return handle | kTableTag;
+        }
+
+        static void ReleaseIndex(uint32_t type, uint32_t index)
+        {
+            ThreadCache* cache = GetThreadCache();
+            if (cache->count[type] == kThreadCacheCapacity)
+            {
+                TypeState& typeState = GetState().types[type];
+                il2cpp::os::FastAutoLock lock(&typeState.mutex);
+
+                cache->count[type] -= kThreadCacheBatch;
+                typeState.freeIndices.insert(typeState.freeIndices.end(), &cache->indices[type][cache->count[type]], &cache->indices[type][cache->count[type]] + kThreadCacheBatch);
+            }
+
+            cache->indices[type][cache->count[type]++] = index;
+        }
+
+        static bool Refill(uint32_t type, ThreadCache* cache)
+        {
+            TypeState& typeState = GetState().types[type];
+            il2cpp::os::FastAutoLock lock(&typeState.mutex);
+
+            if (typeState.freeIndices.empty() && !AddSlab(type, typeState))
+                return false;
+
+            uint32_t count = (uint32_t)typeState.freeIndices.size();
+            if (count > kThreadCacheBatch)
+                count = kThreadCacheBatch;
+            for (uint32_t i = 0; i < count; i++)
+            {
+                cache->indices[type][i] = typeState.freeIndices.back();
+                typeState.freeIndices.pop_back();
+            }
+            cache->count[type] = count;
+            return true;
+        }
+
+        // Called with the type's mutex held.
+        static bool AddSlab(uint32_t type, TypeState& typeState)
+        {
+            if (typeState.slabCount == kMaxSlabs)
+                return false;
+
+            size_t size = kSlotsPerSlab * sizeof(void*);
+            void* slab = IsWeak(type) ? IL2CPP_MALLOC_ZERO(size) : GarbageCollector::AllocateFixed(size, NULL);
+            if (slab == NULL)
+                return false;
+            if (!IsWeak(type))
+                memset(slab, 0, size);
+
+            uint32_t slabIndex = typeState.slabCount++;
+            il2cpp::os::atomic_store_explicit(reinterpret_cast<volatile atomic_word*>(&GetSlabDirectory(type)[slabIndex]), (atomic_word)slab, il2cpp::os::memory_order_release);
+
+            // Lowest indices on top so that handles are handed out in address order.
+            for (uint32_t slot = kSlotsPerSlab; slot > 0; slot--)
+                typeState.freeIndices.push_back((slabIndex << kSlabShift) | (slot - 1));
+            return true;
+        }
+    };
+} /* gc */
+} /* il2cpp */
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "os/ErrorCodes.h"
+#include "os/ThreadLocalValue.h"
+#include "utils/NonCopyable.h"
+
+#if IL2CPP_SUPPORT_THREADS && IL2CPP_THREADS_PTHREAD
+#include <pthread.h>
+#endif
+
+namespace il2cpp
+{
+namespace os
+{
+    // ThreadLocalValue plus a callback that runs on each exiting thread whose value is not
+    // NULL, so per-thread caches can be handed back instead of leaked. The callback needs
+    // pthread key destructors; elsewhere this is a plain ThreadLocalValue and values of
+    // exiting threads are leaked. The callback does not run for the thread that calls exit,
+    // and it must not rely on objects with static storage that may already be destroyed.
+    class CleanupThreadLocalValue : public il2cpp::utils::NonCopyable
+    {
+    public:
+        typedef void (*CleanupFunc)(void* value);
+
+#if IL2CPP_SUPPORT_THREADS && IL2CPP_THREADS_PTHREAD
+        explicit CleanupThreadLocalValue(CleanupFunc cleanup)
+        {
+            int result = pthread_key_create(&m_Key, cleanup);
+            IL2CPP_ASSERT(!result);
+            (void)result;
+        }
+
+        ~CleanupThreadLocalValue()
+        {
+            pthread_key_delete(m_Key);
+        }
+
+        ErrorCode SetValue(void* value)
+        {
+            return pthread_setspecific(m_Key, value) == 0 ? kErrorCodeSuccess : kErrorCodeGenFailure;
+        }
+
+        ErrorCode GetValue(void** value)
+        {
+            *value = pthread_getspecific(m_Key);
+            return kErrorCodeSuccess;
+        }
+
+    private:
+        pthread_key_t m_Key;
+#else
+        explicit CleanupThreadLocalValue(CleanupFunc)
+        {
+        }
+
+        ErrorCode SetValue(void* value)
+        {
+            return m_Value.SetValue(value);
+        }
+
+        ErrorCode GetValue(void** value)
+        {
+            return m_Value.GetValue(value);
+        }
+
+    private:
+        ThreadLocalValue m_Value;
+#endif
+    };
+}
+}
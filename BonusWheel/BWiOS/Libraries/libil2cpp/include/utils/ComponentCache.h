@@ -0,0 +1,165 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/HashUtils.h"
+#include "utils/NonCopyable.h"
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Per GameObject cache of GetComponent results.
+///
+/// Component.GetComponent and GameObject.GetComponentFastPath search the native
+/// component list on every call, and UI code asks the same GameObjects for the same types
+/// (CanvasRenderer, RectTransform, ILayoutElement) over and over. Each GameObject here has
+/// a few (type, component) ways, and a version counter that OnComponentsChanged bumps on
+/// AddComponent or when a component is destroyed. A way is only trusted while its version
+/// matches, so invalidation is a single increment, and a repeated lookup is one hash probe
+/// and a scan of the ways. "Not found" is cached too, as a NULL component.
+    class ComponentCache : public il2cpp::utils::NonCopyable
+    {
+    public:
+        static const uint32_t kWays = 8;
+
+        ComponentCache() : m_HitCount(0), m_MissCount(0)
+        {
+        }
+
+        /// On a hit sets component (possibly NULL for "no such component") and returns true.
+        bool TryGet(void* gameObject, const void* type, void** component)
+        {
+            ObjectMap::iterator it = m_Objects.find(gameObject);
+            if (it != m_Objects.end())
+            {
+                const Entry& entry = m_Entries[it->second];
+                for (uint32_t i = 0; i < kWays; i++)
+                {
+                    const Way& way = entry.ways[i];
+                    if (way.type == type && way.version == entry.version)
+                    {
+                        m_HitCount++;
+                        *component = way.component;
+                        return true;
+                    }
+                }
+            }
+
+            m_MissCount++;
+            return false;
+        }
+
+        /// Records the result of a native lookup made after a TryGet miss.
+        void Store(void* gameObject, const void* type, void* component)
+        {
+            Entry& entry = m_Entries[GetEntry(gameObject)];
+
+            // Reuse a way holding the type or a stale version before evicting round robin.
+            uint32_t target = kWays;
+            for (uint32_t i = 0; i < kWays && target == kWays; i++)
+            {
+                if (entry.ways[i].type == type || entry.ways[i].version != entry.version)
+                    target = i;
+            }
+            if (target == kWays)
+            {
+                target = entry.nextVictim;
+                entry.nextVictim = (entry.nextVictim + 1) % kWays;
+            }
+
+            Way& way = entry.ways[target];
+            way.type = type;
+            way.component = component;
+            way.version = entry.version;
+        }
+
+        /// AddComponent or a component's destruction on gameObject.
+        void OnComponentsChanged(void* gameObject)
+        {
+            ObjectMap::iterator it = m_Objects.find(gameObject);
+            if (it != m_Objects.end())
+                m_Entries[it->second].version++;
+        }
+
+        void OnGameObjectDestroyed(void* gameObject)
+        {
+            ObjectMap::iterator it = m_Objects.find(gameObject);
+            if (it == m_Objects.end())
+                return;
+
+            m_FreeEntries.push_back(it->second);
+            m_Objects.erase(it);
+        }
+
+        void Clear()
+        {
+            m_Objects.clear();
+            m_Entries.clear();
+            m_FreeEntries.clear();
+        }
+
+        uint64_t GetHitCount() const { return m_HitCount; }
+        uint64_t GetMissCount() const { return m_MissCount; }
+
+    private:
+        struct Way
+        {
+            const void* type;
+            void* component;
+            uint32_t version;
+        };
+
+        struct Entry
+        {
+            uint32_t version;
+            uint32_t nextVictim;
+            Way ways[kWays];
+        };
+
+        typedef std::unordered_map<void*, uint32_t, il2cpp::utils::PassThroughHash<void*> > ObjectMap;
+
+        uint32_t GetEntry(void* gameObject)
+        {
+            ObjectMap::iterator it = m_Objects.find(gameObject);
+            if (it != m_Objects.end())
+                return it->second;
+
+            uint32_t index;
+            if (!m_FreeEntries.empty())
+            {
+                index = m_FreeEntries.back();
+                m_FreeEntries.pop_back();
+            }
+            else
+            {
+                index = (uint32_t)m_Entries.size();
+                m_Entries.push_back(Entry());
+            }
+
+            // Version 1 with all ways at version 0 starts the entry empty.
+            Entry& entry = m_Entries[index];
+            entry.version = 1;
+            entry.nextVictim = 0;
+            for (uint32_t i = 0; i < kWays; i++)
+            {
+                entry.ways[i].type = NULL;
+                entry.ways[i].component = NULL;
+                entry.ways[i].version = 0;
+            }
+
+            m_Objects.insert(std::make_pair(gameObject, index));
+            return index;
+        }
+
+        ObjectMap m_Objects;
+        std::vector<Entry> m_Entries;
+        std::vector<uint32_t> m_FreeEntries;
+
+        uint64_t m_HitCount;
+        uint64_t m_MissCount;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
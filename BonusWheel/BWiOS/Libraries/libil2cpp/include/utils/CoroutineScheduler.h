@@ -0,0 +1,320 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/NonCopyable.h"
+#include <stdint.h>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Hierarchical timer wheel for coroutine wake-ups.
+///
+/// Each `yield return new WaitForSeconds(...)` allocates a yield instruction and queues
+/// the coroutine for a time check every frame. Here a waiting coroutine is one pooled
+/// node linked into a wheel slot: a 256 slot wheel of single ticks and three 64 slot
+/// wheels of 256, 16384 and 1048576 ticks, plus an overflow list for longer waits. Entries
+/// cascade into finer wheels as their time comes closer, so scheduling and cancelling are
+/// O(1) and a frame only visits the slots for the ticks that passed and the coroutines
+/// actually due, however many are waiting. `yield return null` takes the next frame list
+/// directly.
+///
+/// Ticks are the caller's unit (milliseconds of scaled time for WaitForSeconds). Advance
+/// returns every coroutine due by the given time as one batch, next frame resumptions
+/// first and timers after in tick order, for the caller to resume with InvokeMoveNext.
+/// Coroutines scheduled while the batch is resumed wait for the next Advance.
+    class CoroutineScheduler : public il2cpp::utils::NonCopyable
+    {
+    public:
+        typedef uint64_t Handle;
+        static const Handle kInvalidHandle = 0;
+
+        explicit CoroutineScheduler(uint64_t now = 0)
+            : m_Now(now), m_FirstFreeNode(kNone), m_TimerCount(0), m_Wheel0Count(0)
+        {
+            for (uint32_t i = 0; i < kListCount; i++)
+            {
+                m_Lists[i].head = kNone;
+                m_Lists[i].tail = kNone;
+            }
+        }
+
+        /// WaitForSeconds: resumes the coroutine at the first Advance at or after dueTime.
+        Handle ScheduleAt(void* coroutine, uint64_t dueTime)
+        {
+            uint32_t index = AllocateNode(coroutine, dueTime);
+            if (dueTime <= m_Now)
+            {
+                Append(kNextFrameList, index);
+            }
+            else
+            {
+                Insert(index);
+                m_TimerCount++;
+            }
+            return MakeHandle(index);
+        }
+
+        Handle ScheduleAfter(void* coroutine, uint64_t delay)
+        {
+            return ScheduleAt(coroutine, m_Now + delay);
+        }
+
+        /// yield return null: resumes the coroutine at the next Advance.
+        Handle ScheduleNextFrame(void* coroutine)
+        {
+            uint32_t index = AllocateNode(coroutine, m_Now);
+            Append(kNextFrameList, index);
+            return MakeHandle(index);
+        }
+
+        /// StopCoroutine: drops a pending wake-up. Returns false once it has fired.
+        bool Cancel(Handle handle)
+        {
+            uint32_t index = (uint32_t)handle;
+            if (index >= m_Nodes.size() || m_Nodes[index].generation != (uint32_t)(handle >> 32) || m_Nodes[index].list == kNoList)
+                return false;
+
+            if (m_Nodes[index].list != kNextFrameList)
+                m_TimerCount--;
+            Unlink(index);
+            FreeNode(index);
+            return true;
+        }
+
+        /// Moves time forward and returns the coroutines now due. The batch is reused by
+        /// the next call.
+        const std::vector<void*>& Advance(uint64_t now)
+        {
+            m_Batch.clear();
+            Drain(kNextFrameList);
+
+            if (now <= m_Now)
+                return m_Batch;
+
+            if (m_TimerCount == 0)
+            {
+                m_Now = now;
+                return m_Batch;
+            }
+
+            while (m_Now < now && m_TimerCount > 0)
+            {
+                // With wheel 0 empty nothing fires before the next revolution, so skip to
+                // its last tick rather than visiting each empty slot.
+                if (m_Wheel0Count == 0)
+                {
+                    uint64_t lastTickOfRevolution = m_Now | kWheel0Mask;
+                    if (lastTickOfRevolution >= now)
+                        break;
+                    m_Now = lastTickOfRevolution;
+                }
+
+                uint64_t tick = ++m_Now;
+                if ((tick & kWheel0Mask) == 0)
+                    Cascade(tick);
+
+                size_t before = m_Batch.size();
+                Drain(Wheel0List(tick));
+                m_TimerCount -= (uint32_t)(m_Batch.size() - before);
+            }
+
+            if (m_Now < now)
+                m_Now = now;
+            return m_Batch;
+        }
+
+        uint64_t GetTime() const { return m_Now; }
+        uint32_t GetTimerCount() const { return m_TimerCount; }
+
+    private:
+        static const uint32_t kNone = 0xFFFFFFFF;
+
+        static const uint32_t kWheel0Bits = 8;
+        static const uint32_t kWheelBits = 6;
+        static const uint32_t kWheel0Size = 1 << kWheel0Bits;
+        static const uint32_t kWheelSize = 1 << kWheelBits;
+        static const uint64_t kWheel0Mask = kWheel0Size - 1;
+        static const uint32_t kUpperWheels = 3;
+
+        // List ids: wheel 0 slots, then the upper wheels' slots, then overflow and next frame.
+        static const uint16_t kOverflowList = kWheel0Size + kUpperWheels * kWheelSize;
+        static const uint16_t kNextFrameList = kOverflowList + 1;
+        static const uint16_t kListCount = kNextFrameList + 1;
+        static const uint16_t kNoList = 0xFFFF;
+
+        struct Node
+        {
+            void* coroutine;
+            uint64_t dueTime;
+            uint32_t prev;
+            uint32_t next;          // next free node while free
+            uint32_t generation;
+            uint16_t list;
+        };
+
+        struct List
+        {
+            uint32_t head;
+            uint32_t tail;
+        };
+
+        static uint16_t Wheel0List(uint64_t tick)
+        {
+            return (uint16_t)(tick & kWheel0Mask);
+        }
+
+        static uint16_t UpperList(uint32_t wheel, uint64_t tick)
+        {
+            uint32_t shift = kWheel0Bits + wheel * kWheelBits;
+            return (uint16_t)(kWheel0Size + wheel * kWheelSize + ((tick >> shift) & (kWheelSize - 1)));
+        }
+
+        void Insert(uint32_t index)
+        {
+            uint64_t due = m_Nodes[index].dueTime;
+            uint64_t delta = due - m_Now;
+
+            if (delta < ((uint64_t)1 << kWheel0Bits))
+            {
+                Append(Wheel0List(due), index);
+                return;
+            }
+
+            for (uint32_t wheel = 0; wheel < kUpperWheels; wheel++)
+            {
+                if (delta < ((uint64_t)1 << (kWheel0Bits + (wheel + 1) * kWheelBits)))
+                {
+                    Append(UpperList(wheel, due), index);
+                    return;
+                }
+            }
+
+            Append(kOverflowList, index);
+        }
+
+        // Called when tick starts a new wheel 0 revolution: moves the entries of the upper
+        // slots that tick enters down to finer wheels, coarsest last as in the classic wheel.
+        void Cascade(uint64_t tick)
+        {
+            for (uint32_t wheel = 0; wheel < kUpperWheels; wheel++)
+            {
+                Redistribute(UpperList(wheel, tick));
+
+                uint32_t shift = kWheel0Bits + (wheel + 1) * kWheelBits;
+                if ((tick & (((uint64_t)1 << shift) - 1)) != 0)
+                    return;
+            }
+
+            Redistribute(kOverflowList);
+        }
+
+        void Redistribute(uint16_t list)
+        {
+            uint32_t index = m_Lists[list].head;
+            m_Lists[list].head = kNone;
+            m_Lists[list].tail = kNone;
+
+            while (index != kNone)
+            {
+                uint32_t next = m_Nodes[index].next;
+                Insert(index);
+                index = next;
+            }
+        }
+
+        void Drain(uint16_t list)
+        {
+            uint32_t index = m_Lists[list].head;
+            m_Lists[list].head = kNone;
+            m_Lists[list].tail = kNone;
+
+            while (index != kNone)
+            {
+                uint32_t next = m_Nodes[index].next;
+                if (list < kWheel0Size)
+                    m_Wheel0Count--;
+                m_Batch.push_back(m_Nodes[index].coroutine);
+                FreeNode(index);
+                index = next;
+            }
+        }
+
+        void Append(uint16_t list, uint32_t index)
+        {
+            Node& node = m_Nodes[index];
+            if (list < kWheel0Size)
+                m_Wheel0Count++;
+            node.list = list;
+            node.next = kNone;
+            node.prev = m_Lists[list].tail;
+            if (node.prev != kNone)
+                m_Nodes[node.prev].next = index;
+            else
+                m_Lists[list].head = index;
+            m_Lists[list].tail = index;
+        }
+
+        void Unlink(uint32_t index)
+        {
+            Node& node = m_Nodes[index];
+            if (node.list < kWheel0Size)
+                m_Wheel0Count--;
+            List& list = m_Lists[node.list];
+            if (node.prev != kNone)
+                m_Nodes[node.prev].next = node.next;
+            else
+                list.head = node.next;
+            if (node.next != kNone)
+                m_Nodes[node.next].prev = node.prev;
+            else
+                list.tail = node.prev;
+        }
+
+        uint32_t AllocateNode(void* coroutine, uint64_t dueTime)
+        {
+            uint32_t index;
+            if (m_FirstFreeNode != kNone)
+            {
+                index = m_FirstFreeNode;
+                m_FirstFreeNode = m_Nodes[index].next;
+            }
+            else
+            {
+                index = (uint32_t)m_Nodes.size();
+                Node node = {};
+                m_Nodes.push_back(node);
+            }
+
+            Node& node = m_Nodes[index];
+            node.coroutine = coroutine;
+            node.dueTime = dueTime;
+            node.generation++;
+            return index;
+        }
+
+        void FreeNode(uint32_t index)
+        {
+            Node& node = m_Nodes[index];
+            node.coroutine = NULL;
+            node.list = kNoList;
+            node.next = m_FirstFreeNode;
+            m_FirstFreeNode = index;
+        }
+
+        Handle MakeHandle(uint32_t index) const
+        {
+            return ((Handle)m_Nodes[index].generation << 32) | index;
+        }
+
+        uint64_t m_Now;
+        std::vector<Node> m_Nodes;
+        uint32_t m_FirstFreeNode;
+        List m_Lists[kListCount];
+        uint32_t m_TimerCount;
+        uint32_t m_Wheel0Count;
+        std::vector<void*> m_Batch;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "os/Atomic.h"
+#include "utils/NonCopyable.h"
+#include <algorithm>
+#include <stdint.h>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Hash free replacement for UnityEngine.UI.Collections.IndexedSet<T>.
+///
+/// IndexedSet pairs a List<T> with a Dictionary<T, int>, so every Add, Remove and
+/// Contains hashes a UnityEngine.Object. Here Add returns a generational handle that the
+/// element keeps (a field on the Graphic or ICanvasElement), and membership is a check of
+/// that handle against a slot table: no hashing, no equality calls. Items stay densely
+/// packed for iteration and removal swaps the last item in, as IndexedSet does.
+///
+/// Handles are 64 bit: the set's id in the top 16 bits, then a 24 bit slot generation and
+/// a 24 bit slot index. Removing an item bumps the generation, so a stale handle held by
+/// an element that was removed (or whose set was cleared) fails Contains and Remove
+/// instead of hitting whatever reuses the slot. The set id makes a handle from another
+/// set of the same type fail too, rather than alias a slot of this one; ids come from a
+/// process wide counter and only repeat after 65535 sets have been created. Still, an
+/// element in several sets needs one handle field per set. kInvalidHandle is never
+/// handed out.
+    template<typename T>
+    class DenseIndexedSet : public il2cpp::utils::NonCopyable
+    {
+    public:
+        typedef uint64_t Handle;
+        static const Handle kInvalidHandle = 0;
+
+        static const uint32_t kMaxSlots = 1 << 24;
+
+        DenseIndexedSet() : m_FirstFreeSlot(kNoSlot), m_SetId(NextSetId())
+        {
+        }
+
+        Handle Add(const T& item)
+        {
+            uint32_t slotIndex;
+            if (m_FirstFreeSlot != kNoSlot)
+            {
+                slotIndex = m_FirstFreeSlot;
+                m_FirstFreeSlot = m_Slots[slotIndex].denseIndex;
+                m_Slots[slotIndex].generation = (m_Slots[slotIndex].generation + 1) & kGenerationMask;
+            }
+            else
+            {
+                slotIndex = (uint32_t)m_Slots.size();
+                IL2CPP_ASSERT(slotIndex < kMaxSlots);
+                Slot slot = { 0, 1 };
+                m_Slots.push_back(slot);
+            }
+
+            m_Slots[slotIndex].denseIndex = (uint32_t)m_Items.size();
+            m_Items.push_back(item);
+            m_SlotOfItem.push_back(slotIndex);
+            return MakeHandle(slotIndex, m_Slots[slotIndex].generation);
+        }
+
+        /// IndexedSet.AddUnique: adds the item unless handle already refers to it, and
+        /// updates handle. Returns whether the item was added.
+        bool AddUnique(Handle& handle, const T& item)
+        {
+            if (Contains(handle))
+                return false;
+
+            handle = Add(item);
+            return true;
+        }
+
+        bool Contains(Handle handle) const
+        {
+            uint32_t slotIndex = SlotIndex(handle);
+            return SetId(handle) == m_SetId && slotIndex < m_Slots.size() && m_Slots[slotIndex].generation == Generation(handle);
+        }
+
+        /// Swap-removes the item. Returns false for stale or invalid handles.
+        bool Remove(Handle handle)
+        {
+            if (!Contains(handle))
+                return false;
+
+            uint32_t slotIndex = SlotIndex(handle);
+            uint32_t denseIndex = m_Slots[slotIndex].denseIndex;
+            uint32_t last = (uint32_t)m_Items.size() - 1;
+            if (denseIndex != last)
+            {
+                m_Items[denseIndex] = m_Items[last];
+                m_SlotOfItem[denseIndex] = m_SlotOfItem[last];
+                m_Slots[m_SlotOfItem[denseIndex]].denseIndex = denseIndex;
+            }
+            m_Items.pop_back();
+            m_SlotOfItem.pop_back();
+
+            FreeSlot(slotIndex);
+            return true;
+        }
+
+        /// IndexedSet.RemoveAll: removes every item matching the predicate.
+        template<typename Predicate>
+        size_t RemoveAll(Predicate match)
+        {
+            size_t removed = 0;
+            for (size_t i = m_Items.size(); i-- > 0;)
+            {
+                if (!match(m_Items[i]))
+                    continue;
+
+                uint32_t slotIndex = m_SlotOfItem[i];
+                Remove(MakeHandle(slotIndex, m_Slots[slotIndex].generation));
+                removed++;
+            }
+            return removed;
+        }
+
+        /// IndexedSet.Sort: reorders the items; handles stay valid.
+        template<typename Compare>
+        void Sort(Compare compare)
+        {
+            m_SortScratch.clear();
+            for (size_t i = 0; i < m_Items.size(); i++)
+                m_SortScratch.push_back(std::make_pair(m_Items[i], m_SlotOfItem[i]));
+
+            std::sort(m_SortScratch.begin(), m_SortScratch.end(), PairCompare<Compare>(compare));
+
+            for (size_t i = 0; i < m_SortScratch.size(); i++)
+            {
+                m_Items[i] = m_SortScratch[i].first;
+                m_SlotOfItem[i] = m_SortScratch[i].second;
+                m_Slots[m_SortScratch[i].second].denseIndex = (uint32_t)i;
+            }
+        }
+
+        /// Invalidates every handle handed out so far. Capacity is kept.
+        void Clear()
+        {
+            for (size_t i = 0; i < m_SlotOfItem.size(); i++)
+                FreeSlot(m_SlotOfItem[i]);
+            m_Items.clear();
+            m_SlotOfItem.clear();
+        }
+
+        size_t Count() const { return m_Items.size(); }
+        T& operator[](size_t index) { return m_Items[index]; }
+        const T& operator[](size_t index) const { return m_Items[index]; }
+        T* Data() { return m_Items.empty() ? NULL : &m_Items[0]; }
+
+        /// Dense position of the item, for IndexedSet.IndexOf.
+        size_t IndexOf(Handle handle) const
+        {
+            return Contains(handle) ? m_Slots[SlotIndex(handle)].denseIndex : (size_t)-1;
+        }
+
+    private:
+        static const uint32_t kNoSlot = 0xFFFFFFFF;
+        static const uint32_t kGenerationMask = (1 << 24) - 1;
+
+        struct Slot
+        {
+            uint32_t denseIndex;    // next free slot while the slot is free
+            uint32_t generation;    // odd while the slot is in use, even while free
+        };
+
+        template<typename Compare>
+        struct PairCompare
+        {
+            Compare compare;
+            PairCompare(Compare c) : compare(c) {}
+
+            bool operator()(const std::pair<T, uint32_t>& left, const std::pair<T, uint32_t>& right) const
+            {
+                return compare(left.first, right.first);
+            }
+        };
+
+        // 1 to 65535; 0 is left out so that kInvalidHandle belongs to no set.
+        static uint16_t NextSetId()
+        {
+            static volatile int32_t s_LastSetId;
+            for (;;)
+            {
+                uint16_t id = (uint16_t)il2cpp::os::Atomic::Increment(&s_LastSetId);
+                if (id != 0)
+                    return id;
+            }
+        }
+
+        Handle MakeHandle(uint32_t slotIndex, uint32_t generation) const
+        {
+            return ((Handle)m_SetId << 48) | ((Handle)generation << 24) | slotIndex;
+        }
+
+        static uint32_t SlotIndex(Handle handle) { return (uint32_t)handle & (kMaxSlots - 1); }
+        static uint32_t Generation(Handle handle) { return (uint32_t)(handle >> 24) & kGenerationMask; }
+        static uint16_t SetId(Handle handle) { return (uint16_t)(handle >> 48); }
+
+        void FreeSlot(uint32_t slotIndex)
+        {
+            // Generations are odd while in use and even while free, so a free slot never
+            // matches a handle and kInvalidHandle (generation 0) never matches anything.
+            Slot& slot = m_Slots[slotIndex];
+            slot.generation = (slot.generation + 1) & kGenerationMask;
+            slot.denseIndex = m_FirstFreeSlot;
+            m_FirstFreeSlot = slotIndex;
+        }
+
+        std::vector<T> m_Items;
+        std::vector<uint32_t> m_SlotOfItem;
+        std::vector<Slot> m_Slots;
+        uint32_t m_FirstFreeSlot;
+        uint16_t m_SetId;
+        std::vector<std::pair<T, uint32_t> > m_SortScratch;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "os/File.h"
+#include <string>
+
+namespace il2cpp
+{
+namespace utils
+{
+    class FileUtils
+    {
+    public:
+        /// Creates or truncates the file at path and writes the whole buffer to it.
+        static bool WriteAll(const std::string& path, const char* buffer, size_t size)
+        {
+            int error;
+            os::FileHandle* file = os::File::Open(path, kFileModeCreate, kFileAccessWrite, kFileShareRead, kFileOptionsNone, &error);
+            if (error != os::kErrorCodeSuccess)
+                return false;
+
+            bool succeeded = true;
+            while (size > 0 && succeeded)
+            {
+                int chunk = size > (size_t)kIl2CppInt32Max ? kIl2CppInt32Max : (int)size;
+                int32_t written = os::File::Write(file, buffer, chunk, &error);
+                succeeded = error == os::kErrorCodeSuccess && written == chunk;
+                buffer += chunk;
+                size -= chunk;
+            }
+
+            os::File::Close(file, &error);
+            return succeeded;
+        }
+
+        static bool WriteAll(const std::string& path, const std::string& contents)
+        {
+            return WriteAll(path, contents.c_str(), contents.size());
+        }
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,558 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Shortest round-trip formatting of Double and Single, after Ulf Adams' Ryu
+/// ("Ryu: fast float-to-string conversion", PLDI 2018).
+///
+/// ToShortest finds the decimal with the fewest significant digits that parses back to
+/// exactly the same value, picking the one closest to the exact binary value when there
+/// is a choice, using only 64-bit integer arithmetic on 128-bit power of five
+/// multipliers. The Mono formatter behind Formatter_MantissaBitsTable generates 15 or
+/// 17 digits and then retries, which is several times slower and does not produce the
+/// shortest string.
+///
+/// Single values run through the same code with their own mantissa width, which yields
+/// the shortest string for the float interval rather than for the widened double.
+///
+/// The multiplier tables are computed with a small bignum on first use instead of being
+/// embedded, which costs well under a millisecond once and keeps this header readable.
+    class FloatFormatter
+    {
+    public:
+        /// Large enough for "-1.7976931348623157E+308" and every other output.
+        static const size_t kMaxFormattedLength = 32;
+
+        struct Decimal
+        {
+            uint64_t digits;    // significand without trailing zeros, at most 17 digits
+            int32_t exponent;   // value = digits * 10^exponent
+            bool negative;
+        };
+
+        /// Returns false for NaN and infinities.
+        static bool ToShortest(double value, Decimal& result)
+        {
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+
+            uint64_t ieeeMantissa = bits & ((1ULL << kDoubleMantissaBits) - 1);
+            uint32_t ieeeExponent = (uint32_t)((bits >> kDoubleMantissaBits) & ((1u << kDoubleExponentBits) - 1));
+            result.negative = (bits >> 63) != 0;
+
+            if (ieeeExponent == (1u << kDoubleExponentBits) - 1)
+                return false;
+
+            return ToShortest(ieeeMantissa, ieeeExponent, kDoubleMantissaBits, kDoubleExponentBias, result);
+        }
+
+        static bool ToShortest(float value, Decimal& result)
+        {
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+
+            uint32_t ieeeMantissa = bits & ((1u << kFloatMantissaBits) - 1);
+            uint32_t ieeeExponent = (bits >> kFloatMantissaBits) & ((1u << kFloatExponentBits) - 1);
+            result.negative = (bits >> 31) != 0;
+
+            if (ieeeExponent == (1u << kFloatExponentBits) - 1)
+                return false;
+
+            return ToShortest(ieeeMantissa, ieeeExponent, kFloatMantissaBits, kFloatExponentBias, result);
+        }
+
+        /// Writes the shortest string that parses back to the same value, with the layout of
+        /// the invariant culture's "G" format: fixed notation for decimal exponents from -4
+        /// to 14 and "d.dddE+XX" outside of it. The digits are not Mono's: its ToString()
+        /// rounds to 15 significant digits, so 0.1 + 0.2 prints "0.3" there and
+        /// "0.30000000000000004" here, and its "R" tries 15 digits before 17. Use this where
+        /// the text has to round-trip, not where it has to match managed output. Negative
+        /// zero prints "0", as in Mono. Returns the length written, excluding the terminator.
+        static size_t Format(double value, char* buffer)
+        {
+            return Format(value, kDoubleScientificThreshold, buffer);
+        }
+
+        /// As above with Single's threshold: fixed notation for decimal exponents up to 6.
+        /// Mono's Single.ToString() rounds to 7 significant digits instead.
+        static size_t Format(float value, char* buffer)
+        {
+            return Format(value, kFloatScientificThreshold, buffer);
+        }
+
+    private:
+        static const uint32_t kDoubleMantissaBits = 52;
+        static const uint32_t kDoubleExponentBits = 11;
+        static const int32_t kDoubleExponentBias = 1023;
+        static const uint32_t kFloatMantissaBits = 23;
+        static const uint32_t kFloatExponentBits = 8;
+        static const int32_t kFloatExponentBias = 127;
+
+        static const int32_t kDoubleScientificThreshold = 15;
+        static const int32_t kFloatScientificThreshold = 7;
+
+        // Bits kept of 5^i and of 2^k / 5^i, and the largest i each table needs for doubles.
+        static const int32_t kPow5BitCount = 125;
+        static const int32_t kPow5InverseBitCount = 125;
+        static const int32_t kPow5TableSize = 326;
+        static const int32_t kPow5InverseTableSize = 342;
+
+        struct Multiplier
+        {
+            uint64_t low;
+            uint64_t high;
+        };
+
+        struct Tables
+        {
+            Multiplier pow5[kPow5TableSize];
+            Multiplier pow5Inverse[kPow5InverseTableSize];
+
+            Tables()
+            {
+                // 5^i, little endian 32-bit limbs.
+                std::vector<uint32_t> power(1, 1);
+                for (int32_t i = 0; i < kPow5InverseTableSize; i++)
+                {
+                    int32_t bitLength = BitLength(power);
+
+                    if (i < kPow5TableSize)
+                        pow5[i] = ExtractBits(power, bitLength - kPow5BitCount);
+
+                    // floor(2^(bitLength - 1 + kPow5InverseBitCount) / 5^i) + 1
+                    pow5Inverse[i] = DividePowerOfTwo(power, bitLength - 1 + kPow5InverseBitCount);
+                    if (++pow5Inverse[i].low == 0)
+                        pow5Inverse[i].high++;
+
+                    MultiplyBy5(power);
+                }
+            }
+
+            static int32_t BitLength(const std::vector<uint32_t>& value)
+            {
+                int32_t top = (int32_t)value.size() - 1;
+                uint32_t word = value[top];
+                int32_t bits = 0;
+                while (word != 0)
+                {
+                    bits++;
+                    word >>= 1;
+                }
+                return top * 32 + bits;
+            }
+
+            static void MultiplyBy5(std::vector<uint32_t>& value)
+            {
+                uint64_t carry = 0;
+                for (size_t i = 0; i < value.size(); i++)
+                {
+                    carry += (uint64_t)value[i] * 5;
+                    value[i] = (uint32_t)carry;
+                    carry >>= 32;
+                }
+                if (carry != 0)
+                    value.push_back((uint32_t)carry);
+            }
+
+            static uint32_t GetBit(const std::vector<uint32_t>& value, int32_t bit)
+            {
+                if (bit < 0 || bit / 32 >= (int32_t)value.size())
+                    return 0;
+                return (value[bit / 32] >> (bit % 32)) & 1;
+            }
+
+            // The 128 bits of value >> shift, or value << -shift for negative shifts.
+            static Multiplier ExtractBits(const std::vector<uint32_t>& value, int32_t shift)
+            {
+                Multiplier result = { 0, 0 };
+                for (int32_t bit = 0; bit < 64; bit++)
+                {
+                    result.low |= (uint64_t)GetBit(value, bit + shift) << bit;
+                    result.high |= (uint64_t)GetBit(value, bit + 64 + shift) << bit;
+                }
+                return result;
+            }
+
+            // floor(2^exponent / divisor), for divisor in [2^(exponent - 125), 2^(exponent - 124)),
+            // so the quotient has at most 126 bits. Plain restoring division, one quotient bit at a time.
+            static Multiplier DividePowerOfTwo(const std::vector<uint32_t>& divisor, int32_t exponent)
+            {
+                int32_t divisorBits = BitLength(divisor);
+                std::vector<uint32_t> remainder(divisor.size() + 1, 0);
+
+                // Start with the leading bits of 2^exponent that are still below the divisor.
+                int32_t startBit = divisorBits - 1;
+                remainder[startBit / 32] = 1u << (startBit % 32);
+
+                Multiplier quotient = { 0, 0 };
+                for (int32_t bit = exponent - startBit; bit >= 0; bit--)
+                {
+                    bool subtract = Compare(remainder, divisor) >= 0;
+                    if (subtract)
+                        Subtract(remainder, divisor);
+
+                    quotient.high = (quotient.high << 1) | (quotient.low >> 63);
+                    quotient.low = (quotient.low << 1) | (subtract ? 1 : 0);
+
+                    if (bit > 0)
+                        ShiftLeftOne(remainder);
+                }
+                return quotient;
+            }
+
+            static int Compare(const std::vector<uint32_t>& left, const std::vector<uint32_t>& right)
+            {
+                for (size_t i = left.size(); i-- > 0;)
+                {
+                    uint32_t rightWord = i < right.size() ? right[i] : 0;
+                    if (left[i] != rightWord)
+                        return left[i] < rightWord ? -1 : 1;
+                }
+                return 0;
+            }
+
+            static void Subtract(std::vector<uint32_t>& left, const std::vector<uint32_t>& right)
+            {
+                int64_t borrow = 0;
+                for (size_t i = 0; i < left.size(); i++)
+                {
+                    int64_t difference = (int64_t)left[i] - (i < right.size() ? right[i] : 0) - borrow;
+                    borrow = difference < 0 ? 1 : 0;
+                    left[i] = (uint32_t)difference;
+                }
+            }
+
+            static void ShiftLeftOne(std::vector<uint32_t>& value)
+            {
+                uint32_t carry = 0;
+                for (size_t i = 0; i < value.size(); i++)
+                {
+                    uint32_t next = value[i] >> 31;
+                    value[i] = (value[i] << 1) | carry;
+                    carry = next;
+                }
+            }
+        };
+
+        static const Tables& GetTables()
+        {
+            static Tables s_Tables;
+            return s_Tables;
+        }
+
+        // ceil(log2(5^e)), and 1 for e == 0; exact for 0 <= e <= 3528.
+        static inline int32_t Pow5Bits(int32_t e)
+        {
+            return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+        }
+
+        // floor(log10(2^e)) for 0 <= e <= 1650.
+        static inline uint32_t Log10Pow2(int32_t e)
+        {
+            return ((uint32_t)e * 78913) >> 18;
+        }
+
+        // floor(log10(5^e)) for 0 <= e <= 2620.
+        static inline uint32_t Log10Pow5(int32_t e)
+        {
+            return ((uint32_t)e * 732923) >> 20;
+        }
+
+        static inline bool MultipleOfPowerOf5(uint64_t value, uint32_t p)
+        {
+            uint32_t count = 0;
+            while (value % 5 == 0)
+            {
+                value /= 5;
+                count++;
+            }
+            return count >= p;
+        }
+
+        static inline bool MultipleOfPowerOf2(uint64_t value, uint32_t p)
+        {
+            return (value & ((1ULL << p) - 1)) == 0;
+        }
+
+        static inline uint64_t Multiply64x64(uint64_t a, uint64_t b, uint64_t* productHigh)
+        {
+            uint64_t aLow = (uint32_t)a;
+            uint64_t aHigh = a >> 32;
+            uint64_t bLow = (uint32_t)b;
+            uint64_t bHigh = b >> 32;
+
+            uint64_t lowLow = aLow * bLow;
+            uint64_t lowHigh = aLow * bHigh;
+            uint64_t highLow = aHigh * bLow;
+            uint64_t highHigh = aHigh * bHigh;
+
+            uint64_t middle1 = highLow + (lowLow >> 32);
+            uint64_t middle2 = lowHigh + (uint32_t)middle1;
+
+            *productHigh = highHigh + (middle1 >> 32) + (middle2 >> 32);
+            return (middle2 << 32) | (uint32_t)lowLow;
+        }
+
+        // (m * multiplier) >> shift, for 64 < shift < 128.
+        static inline uint64_t MultiplyShift(uint64_t m, const Multiplier& multiplier, int32_t shift)
+        {
+            uint64_t high1;
+            uint64_t low1 = Multiply64x64(m, multiplier.high, &high1);
+            uint64_t high0;
+            Multiply64x64(m, multiplier.low, &high0);
+
+            uint64_t sum = high0 + low1;
+            if (sum < high0)
+                high1++;
+
+            int32_t distance = shift - 64;
+            return (high1 << (64 - distance)) | (sum >> distance);
+        }
+
+        static bool ToShortest(uint64_t ieeeMantissa, uint32_t ieeeExponent, uint32_t mantissaBits, int32_t exponentBias, Decimal& result)
+        {
+            if (ieeeMantissa == 0 && ieeeExponent == 0)
+            {
+                result.digits = 0;
+                result.exponent = 0;
+                return true;
+            }
+
+            // The value is m2 * 2^e2; the "- 2" makes room for the interval bounds below.
+            int32_t e2;
+            uint64_t m2;
+            if (ieeeExponent == 0)
+            {
+                e2 = 1 - exponentBias - (int32_t)mantissaBits - 2;
+                m2 = ieeeMantissa;
+            }
+            else
+            {
+                e2 = (int32_t)ieeeExponent - exponentBias - (int32_t)mantissaBits - 2;
+                m2 = (1ULL << mantissaBits) | ieeeMantissa;
+            }
+
+            // Round-half-even parsing accepts the interval bounds when the mantissa is even.
+            const bool acceptBounds = (m2 & 1) == 0;
+
+            // The lower neighbor is closer when the mantissa is a power of two (except for the
+            // smallest normal), so the lower half-interval is half as wide.
+            const uint64_t mv = 4 * m2;
+            const uint32_t mmShift = (ieeeMantissa != 0 || ieeeExponent <= 1) ? 1 : 0;
+
+            // Scale the interval (mv - 1 - mmShift, mv, mv + 2) by 2^e2 / 10^e10 into vm, vr, vp.
+            const Tables& tables = GetTables();
+            uint64_t vr, vp, vm;
+            int32_t e10;
+            bool vmIsTrailingZeros = false;
+            bool vrIsTrailingZeros = false;
+
+            if (e2 >= 0)
+            {
+                const uint32_t q = Log10Pow2(e2) - (e2 > 3 ? 1 : 0);
+                e10 = (int32_t)q;
+                const int32_t k = kPow5InverseBitCount + Pow5Bits((int32_t)q) - 1;
+                const int32_t i = -e2 + (int32_t)q + k;
+                vr = MultiplyShift(4 * m2, tables.pow5Inverse[q], i);
+                vp = MultiplyShift(4 * m2 + 2, tables.pow5Inverse[q], i);
+                vm = MultiplyShift(4 * m2 - 1 - mmShift, tables.pow5Inverse[q], i);
+
+                if (q <= 21)
+                {
+                    // Only one of mp, mv and mm can be a multiple of 5, if any.
+                    if (mv % 5 == 0)
+                        vrIsTrailingZeros = MultipleOfPowerOf5(mv, q);
+                    else if (acceptBounds)
+                        vmIsTrailingZeros = MultipleOfPowerOf5(mv - 1 - mmShift, q);
+                    else
+                        vp -= MultipleOfPowerOf5(mv + 2, q) ? 1 : 0;
+                }
+            }
+            else
+            {
+                const uint32_t q = Log10Pow5(-e2) - (-e2 > 1 ? 1 : 0);
+                e10 = (int32_t)q + e2;
+                const int32_t i = -e2 - (int32_t)q;
+                const int32_t k = Pow5Bits(i) - kPow5BitCount;
+                const int32_t j = (int32_t)q - k;
+                vr = MultiplyShift(4 * m2, tables.pow5[i], j);
+                vp = MultiplyShift(4 * m2 + 2, tables.pow5[i], j);
+                vm = MultiplyShift(4 * m2 - 1 - mmShift, tables.pow5[i], j);
+
+                if (q <= 1)
+                {
+                    // mv has at least q trailing zero bits because it is a multiple of 4.
+                    vrIsTrailingZeros = true;
+                    if (acceptBounds)
+                        vmIsTrailingZeros = mmShift == 1;
+                    else
+                        --vp;
+                }
+                else if (q < 63)
+                {
+                    vrIsTrailingZeros = MultipleOfPowerOf2(mv, q);
+                }
+            }
+
+            // Drop digits while the interval still contains a shorter number.
+            int32_t removed = 0;
+            uint8_t lastRemovedDigit = 0;
+            uint64_t output;
+
+            if (vmIsTrailingZeros || vrIsTrailingZeros)
+            {
+                for (;;)
+                {
+                    const uint64_t vpDiv10 = vp / 10;
+                    const uint64_t vmDiv10 = vm / 10;
+                    if (vpDiv10 <= vmDiv10)
+                        break;
+
+                    const uint64_t vrDiv10 = vr / 10;
+                    vmIsTrailingZeros &= vm - vmDiv10 * 10 == 0;
+                    vrIsTrailingZeros &= lastRemovedDigit == 0;
+                    lastRemovedDigit = (uint8_t)(vr - vrDiv10 * 10);
+                    vr = vrDiv10;
+                    vp = vpDiv10;
+                    vm = vmDiv10;
+                    removed++;
+                }
+
+                if (vmIsTrailingZeros)
+                {
+                    for (;;)
+                    {
+                        const uint64_t vmDiv10 = vm / 10;
+                        if (vm - vmDiv10 * 10 != 0)
+                            break;
+
+                        const uint64_t vrDiv10 = vr / 10;
+                        vrIsTrailingZeros &= lastRemovedDigit == 0;
+                        lastRemovedDigit = (uint8_t)(vr - vrDiv10 * 10);
+                        vr = vrDiv10;
+                        vp = vp / 10;
+                        vm = vmDiv10;
+                        removed++;
+                    }
+                }
+
+                // Exactly halfway between two candidates: round to even.
+                if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0)
+                    lastRemovedDigit = 4;
+
+                output = vr + (((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5) ? 1 : 0);
+            }
+            else
+            {
+                // Common case: no exact ties are possible, only the last removed digit matters.
+                bool roundUp = false;
+                for (;;)
+                {
+                    const uint64_t vpDiv10 = vp / 10;
+                    const uint64_t vmDiv10 = vm / 10;
+                    if (vpDiv10 <= vmDiv10)
+                        break;
+
+                    const uint64_t vrDiv10 = vr / 10;
+                    roundUp = vr - vrDiv10 * 10 >= 5;
+                    vr = vrDiv10;
+                    vp = vpDiv10;
+                    vm = vmDiv10;
+                    removed++;
+                }
+
+                output = vr + ((vr == vm || roundUp) ? 1 : 0);
+            }
+
+            int32_t exponent = e10 + removed;
+
+            // The interval can end on a round number, e.g. 9.5e22 -> 95e21; trim what is left.
+            while (output != 0 && output % 10 == 0)
+            {
+                output /= 10;
+                exponent++;
+            }
+
+            result.digits = output;
+            result.exponent = exponent;
+            return true;
+        }
+
+        template<typename T>
+        static size_t Format(T value, int32_t scientificThreshold, char* buffer)
+        {
+            Decimal decimal;
+            if (!ToShortest(value, decimal))
+            {
+                const char* special = value != value ? "NaN" : (value < 0 ? "-Infinity" : "Infinity");
+                size_t length = strlen(special);
+                memcpy(buffer, special, length + 1);
+                return length;
+            }
+
+            char digits[20];
+            int32_t digitCount = 0;
+            for (uint64_t remaining = decimal.digits; remaining != 0 || digitCount == 0; remaining /= 10)
+                digits[digitCount++] = (char)('0' + remaining % 10);
+
+            char* out = buffer;
+            if (decimal.negative && decimal.digits != 0)
+                *out++ = '-';
+
+            // Position of the decimal point relative to the first digit, as in .NET's "G" formatting.
+            int32_t scale = decimal.digits == 0 ? 1 : decimal.exponent + digitCount;
+
+            if (scale > scientificThreshold || scale < -3)
+            {
+                *out++ = digits[digitCount - 1];
+                if (digitCount > 1)
+                {
+                    *out++ = '.';
+                    for (int32_t i = digitCount - 2; i >= 0; i--)
+                        *out++ = digits[i];
+                }
+
+                int32_t exponent = scale - 1;
+                *out++ = 'E';
+                *out++ = exponent < 0 ? '-' : '+';
+                if (exponent < 0)
+                    exponent = -exponent;
+                if (exponent >= 100)
+                    *out++ = (char)('0' + exponent / 100);
+                *out++ = (char)('0' + exponent / 10 % 10);
+                *out++ = (char)('0' + exponent % 10);
+            }
+            else if (scale <= 0)
+            {
+                *out++ = '0';
+                *out++ = '.';
+                for (int32_t i = scale; i < 0; i++)
+                    *out++ = '0';
+                for (int32_t i = digitCount - 1; i >= 0; i--)
+                    *out++ = digits[i];
+            }
+            else
+            {
+                for (int32_t i = 0; i < scale; i++)
+                    *out++ = i < digitCount ? digits[digitCount - 1 - i] : '0';
+                if (digitCount > scale)
+                {
+                    *out++ = '.';
+                    for (int32_t i = digitCount - 1 - scale; i >= 0; i--)
+                        *out++ = digits[i];
+                }
+            }
+
+            *out = '\0';
+            return out - buffer;
+        }
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
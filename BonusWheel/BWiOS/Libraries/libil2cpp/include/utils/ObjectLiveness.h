@@ -0,0 +1,115 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "os/Atomic.h"
+#include "os/Mutex.h"
+#include "utils/Memory.h"
+#include <stdint.h>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+    template<typename T>
+    struct ObjectLivenessDeadWord
+    {
+        static volatile uint32_t value;
+    };
+
+    template<typename T>
+    volatile uint32_t ObjectLivenessDeadWord<T>::value = 0;
+
+    /// What a managed wrapper (or any code caching a UnityEngine.Object) keeps next to the
+    /// object: the address of the native object's liveness word and the generation it had
+    /// when the token was taken. A default constructed token stands for null.
+    struct LivenessToken
+    {
+        const volatile uint32_t* word;
+        uint32_t generation;
+
+        LivenessToken() : word(&ObjectLivenessDeadWord<void>::value), generation(1) {}
+        LivenessToken(const volatile uint32_t* word_, uint32_t generation_) : word(word_), generation(generation_) {}
+    };
+
+/// Liveness generations for native objects behind UnityEngine.Object wrappers.
+///
+/// `obj == null` on a UnityEngine.Object goes through Object.op_Equality,
+/// CompareBaseObjects, IsNativeObjectAlive and GetCachedPtr: out of line calls behind
+/// method and class initialization guards that end in a load of m_CachedPtr, which the
+/// engine clears on destroy. Generated UI code hits that path constantly (Graphic.canvas,
+/// LayoutRebuilder's IsDestroyed checks). Here every native object gets a 32 bit word in a
+/// table whose storage is never freed. The word holds an odd generation while the object
+/// lives, and destroying the object bumps it to even. A token copied into the wrapper
+/// then answers "null or destroyed" with one load and one compare, without a call and
+/// without a null branch, since null tokens point at a word that is always 0.
+///
+/// Words are recycled for new objects with the next odd generation, so tokens of earlier
+/// objects keep failing. Destruction is expected on the main thread, and a check racing
+/// with it on another thread may still see the object alive, as with m_CachedPtr.
+    class ObjectLiveness
+    {
+    public:
+        static IL2CPP_FORCE_INLINE bool IsAlive(const LivenessToken& token)
+        {
+            return *token.word == token.generation;
+        }
+
+        /// Called when the native object is created; the token is handed to its wrapper.
+        static LivenessToken Register()
+        {
+            State& state = GetState();
+            os::FastAutoLock lock(&state.mutex);
+
+            if (state.freeWords.empty())
+                AddSlab(state);
+
+            volatile uint32_t* word = state.freeWords.back();
+            state.freeWords.pop_back();
+
+            // Free words hold an even generation; the next odd one marks the new object.
+            uint32_t generation = os::Atomic::Increment(word);
+            return LivenessToken(word, generation);
+        }
+
+        /// Called when the native object is destroyed. Every token taken from it, copies
+        /// included, reports dead from then on. Tokens that are already dead are ignored.
+        static void MarkDestroyed(const LivenessToken& token)
+        {
+            volatile uint32_t* word = const_cast<volatile uint32_t*>(token.word);
+            if (os::Atomic::CompareExchange(word, token.generation + 1, token.generation) != token.generation)
+                return;
+
+            State& state = GetState();
+            os::FastAutoLock lock(&state.mutex);
+            state.freeWords.push_back(word);
+        }
+
+    private:
+        static const uint32_t kWordsPerSlab = 1024;
+
+        struct State
+        {
+            os::FastMutex mutex;
+            std::vector<volatile uint32_t*> freeWords;
+        };
+
+        static State& GetState()
+        {
+            static State s_State;
+            return s_State;
+        }
+
+        // Called with the mutex held. Slabs are never freed, so token words stay readable
+        // after their objects are gone.
+        static void AddSlab(State& state)
+        {
+            volatile uint32_t* slab = static_cast<volatile uint32_t*>(IL2CPP_MALLOC_ZERO(kWordsPerSlab * sizeof(uint32_t)));
+            IL2CPP_ASSERT(slab != NULL);
+
+            for (uint32_t i = kWordsPerSlab; i > 0; i--)
+                state.freeWords.push_back(&slab[i - 1]);
+        }
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,275 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "os/Atomic.h"
+#include "os/Mutex.h"
+#include "os/CleanupThreadLocalValue.h"
+#include "utils/NonCopyable.h"
+#include <stdint.h>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Thread safe object pool in the shape of UnityEngine.UI.ObjectPool<T> and ListPool<T>.
+///
+/// The UI pools are main thread only, keep every object ever released and report
+/// nothing. This pool gives each thread a small cache, so Get and Release normally touch
+/// only thread local state. Full or empty caches exchange kBatch items with a shared list
+/// under a lock. Once the shared list grows past the high-water mark, the excess is
+/// destroyed instead of kept. Counters for gets, releases, misses (objects created),
+/// destroyed objects and the peak number of live objects show what a pool actually needs.
+///
+/// Items are opaque. To pool managed objects, the callbacks should hold them through
+/// strong handles (gc::GCHandleTable) so the collector sees them while pooled.
+///
+/// When a thread exits, its cached items go back to the shared list, its counters are
+/// folded into the pool's and its cache is freed, where os::CleanupThreadLocalValue
+/// supports that (pthreads). Elsewhere a thread that stops using the pool should call
+/// FlushThreadCache, or its cached items are only reclaimed when the pool is destroyed.
+/// Each pool takes one TLS key, a limited resource, so pools are meant to be long lived
+/// and few, and a pool must not be destroyed while threads that used it may still exit.
+    class ObjectPool : public il2cpp::utils::NonCopyable
+    {
+    public:
+        typedef void* (*CreateFunc)(void* context);
+        typedef void (*ItemFunc)(void* item, void* context);
+
+        struct Statistics
+        {
+            uint64_t getCount;
+            uint64_t releaseCount;
+            uint64_t missCount;
+            uint64_t destroyCount;
+            int64_t liveCount;
+            int64_t peakLiveCount;
+            size_t sharedCount;
+        };
+
+        static const uint32_t kBatch = 16;
+        static const uint32_t kThreadCacheCapacity = 2 * kBatch;
+
+        /// onGet and onRelease may be NULL, like actionOnGet and actionOnRelease.
+        ObjectPool(CreateFunc create, ItemFunc onGet, ItemFunc onRelease, ItemFunc destroy, void* context, size_t highWaterMark = 256)
+            : m_Create(create), m_OnGet(onGet), m_OnRelease(onRelease), m_Destroy(destroy), m_Context(context),
+            m_ThreadCache(ReleaseThreadCache), m_HighWaterMark(highWaterMark), m_RetiredGetCount(0), m_RetiredReleaseCount(0),
+            m_RetiredMissCount(0), m_LiveCount(0), m_PeakLiveCount(0), m_DestroyCount(0)
+        {
+        }
+
+        ~ObjectPool()
+        {
+            for (size_t i = 0; i < m_ThreadCaches.size(); i++)
+            {
+                ThreadCache* cache = m_ThreadCaches[i];
+                for (uint32_t j = 0; j < cache->count; j++)
+                    m_Destroy(cache->items[j], m_Context);
+                delete cache;
+            }
+
+            for (size_t i = 0; i < m_Shared.size(); i++)
+                m_Destroy(m_Shared[i], m_Context);
+        }
+
+        void* Get()
+        {
+            ThreadCache* cache = GetThreadCache();
+            os::Atomic::Increment64(&cache->getCount);
+
+            void* item;
+            if (cache->count > 0 || Refill(cache))
+            {
+                item = cache->items[--cache->count];
+            }
+            else
+            {
+                os::Atomic::Increment64(&cache->missCount);
+                item = m_Create(m_Context);
+                UpdatePeak(os::Atomic::Increment64(&m_LiveCount));
+            }
+
+            if (m_OnGet != NULL)
+                m_OnGet(item, m_Context);
+            return item;
+        }
+
+        void Release(void* item)
+        {
+            ThreadCache* cache = GetThreadCache();
+            IL2CPP_ASSERT(cache->count == 0 || cache->items[cache->count - 1] != item);
+            os::Atomic::Increment64(&cache->releaseCount);
+
+            if (m_OnRelease != NULL)
+                m_OnRelease(item, m_Context);
+
+            if (cache->count == kThreadCacheCapacity)
+                Spill(cache, kBatch);
+            cache->items[cache->count++] = item;
+        }
+
+        /// Moves the calling thread's cached items to the shared list.
+        void FlushThreadCache()
+        {
+            ThreadCache* cache = GetThreadCache();
+            Spill(cache, cache->count);
+        }
+
+        /// Sets the most items the shared list keeps and destroys any excess right away.
+        void SetHighWaterMark(size_t highWaterMark)
+        {
+            os::FastAutoLock lock(&m_Mutex);
+            m_HighWaterMark = highWaterMark;
+            TrimLocked();
+        }
+
+        /// Counters summed over all threads. Per thread counters are read without stopping
+        /// their threads, so a snapshot taken under load may be off by in-flight calls.
+        Statistics GetStatistics()
+        {
+            Statistics stats = {};
+            os::FastAutoLock lock(&m_Mutex);
+            stats.getCount = m_RetiredGetCount;
+            stats.releaseCount = m_RetiredReleaseCount;
+            stats.missCount = m_RetiredMissCount;
+            for (size_t i = 0; i < m_ThreadCaches.size(); i++)
+            {
+                ThreadCache* cache = m_ThreadCaches[i];
+                stats.getCount += (uint64_t)os::Atomic::Read64(&cache->getCount);
+                stats.releaseCount += (uint64_t)os::Atomic::Read64(&cache->releaseCount);
+                stats.missCount += (uint64_t)os::Atomic::Read64(&cache->missCount);
+            }
+
+            stats.destroyCount = (uint64_t)os::Atomic::Read64(&m_DestroyCount);
+            stats.liveCount = os::Atomic::Read64(&m_LiveCount);
+            stats.peakLiveCount = os::Atomic::Read64(&m_PeakLiveCount);
+            stats.sharedCount = m_Shared.size();
+            return stats;
+        }
+
+    private:
+        struct ThreadCache
+        {
+            ObjectPool* pool;
+            uint32_t count;
+            void* items[kThreadCacheCapacity];
+            volatile int64_t getCount;
+            volatile int64_t releaseCount;
+            volatile int64_t missCount;
+        };
+
+        ThreadCache* GetThreadCache()
+        {
+            void* value = NULL;
+            m_ThreadCache.GetValue(&value);
+            if (value != NULL)
+                return static_cast<ThreadCache*>(value);
+
+            ThreadCache* cache = new ThreadCache();
+            cache->pool = this;
+            m_ThreadCache.SetValue(cache);
+
+            os::FastAutoLock lock(&m_Mutex);
+            m_ThreadCaches.push_back(cache);
+            return cache;
+        }
+
+        // Runs on an exiting thread that used the pool.
+        static void ReleaseThreadCache(void* value)
+        {
+            ThreadCache* cache = static_cast<ThreadCache*>(value);
+            ObjectPool* pool = cache->pool;
+
+            os::FastAutoLock lock(&pool->m_Mutex);
+            pool->m_Shared.insert(pool->m_Shared.end(), &cache->items[0], &cache->items[0] + cache->count);
+            pool->TrimLocked();
+
+            pool->m_RetiredGetCount += (uint64_t)os::Atomic::Read64(&cache->getCount);
+            pool->m_RetiredReleaseCount += (uint64_t)os::Atomic::Read64(&cache->releaseCount);
+            pool->m_RetiredMissCount += (uint64_t)os::Atomic::Read64(&cache->missCount);
+
+            std::vector<ThreadCache*>& caches = pool->m_ThreadCaches;
+            for (size_t i = 0; i < caches.size(); i++)
+            {
+                if (caches[i] == cache)
+                {
+                    caches[i] = caches.back();
+                    caches.pop_back();
+                    break;
+                }
+            }
+            delete cache;
+        }
+
+        bool Refill(ThreadCache* cache)
+        {
+            os::FastAutoLock lock(&m_Mutex);
+            if (m_Shared.empty())
+                return false;
+
+            uint32_t count = m_Shared.size() < kBatch ? (uint32_t)m_Shared.size() : kBatch;
+            for (uint32_t i = 0; i < count; i++)
+            {
+                cache->items[i] = m_Shared.back();
+                m_Shared.pop_back();
+            }
+            cache->count = count;
+            return true;
+        }
+
+        // Moves the count most recently cached items to the shared list.
+        void Spill(ThreadCache* cache, uint32_t count)
+        {
+            if (count == 0)
+                return;
+
+            os::FastAutoLock lock(&m_Mutex);
+            cache->count -= count;
+            m_Shared.insert(m_Shared.end(), &cache->items[cache->count], &cache->items[cache->count] + count);
+            TrimLocked();
+        }
+
+        void TrimLocked()
+        {
+            while (m_Shared.size() > m_HighWaterMark)
+            {
+                m_Destroy(m_Shared.back(), m_Context);
+                m_Shared.pop_back();
+                os::Atomic::Decrement64(&m_LiveCount);
+                os::Atomic::Increment64(&m_DestroyCount);
+            }
+        }
+
+        void UpdatePeak(int64_t liveCount)
+        {
+            for (;;)
+            {
+                int64_t peak = os::Atomic::Read64(&m_PeakLiveCount);
+                if (liveCount <= peak || os::Atomic::CompareExchange64(&m_PeakLiveCount, liveCount, peak) == peak)
+                    return;
+            }
+        }
+
+        CreateFunc m_Create;
+        ItemFunc m_OnGet;
+        ItemFunc m_OnRelease;
+        ItemFunc m_Destroy;
+        void* m_Context;
+
+        os::CleanupThreadLocalValue m_ThreadCache;
+        os::FastMutex m_Mutex;
+        std::vector<ThreadCache*> m_ThreadCaches;
+        std::vector<void*> m_Shared;
+        size_t m_HighWaterMark;
+
+        // Counters of exited threads, guarded by m_Mutex.
+        uint64_t m_RetiredGetCount;
+        uint64_t m_RetiredReleaseCount;
+        uint64_t m_RetiredMissCount;
+
+        volatile int64_t m_LiveCount;
+        volatile int64_t m_PeakLiveCount;
+        volatile int64_t m_DestroyCount;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
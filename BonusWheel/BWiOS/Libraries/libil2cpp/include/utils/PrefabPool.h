@@ -0,0 +1,236 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/HashUtils.h"
+#include "utils/NonCopyable.h"
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Instance pools for prefabs that are instantiated and destroyed in a cycle.
+///
+/// Object.Instantiate clones the whole prefab and runs Awake, OnEnable and the canvas
+/// registrations; Object.Destroy tears all of it down again, and the claim and spin
+/// flow does both on every cycle. Spawn instead hands out an inactive instance kept from
+/// an earlier Release, placing it through the activate callback (reparent, position,
+/// SetActive(true)), and only instantiates on a miss. Release deactivates the instance
+/// and keeps it, up to the prefab's capacity; beyond that it is destroyed. Prewarm
+/// instantiates ahead of time, e.g. during a loading screen.
+///
+/// Instances and prefabs are opaque to the pool. To pool managed objects, the callbacks
+/// should hold them through strong handles (gc::GCHandleTable), as with ObjectPool.
+///
+/// The callbacks may use the pool themselves, e.g. an Awake that spawns pooled children:
+/// each prefab's pool is allocated on its own and stays at its address until Clear, so a
+/// pool being worked on is not moved when a callback adds pools for other prefabs.
+    class PrefabPool : public il2cpp::utils::NonCopyable
+    {
+    public:
+        struct Placement
+        {
+            void* parent;
+            float position[3];
+            float rotation[4];
+        };
+
+        struct Statistics
+        {
+            uint64_t hitCount;
+            uint64_t missCount;
+            uint64_t releaseCount;
+            uint64_t destroyCount;
+            size_t pooledCount;
+            size_t activeCount;
+        };
+
+        typedef void* (*InstantiateFunc)(void* prefab, void* context);
+        typedef void (*ActivateFunc)(void* instance, const Placement& placement, void* context);
+        typedef void (*InstanceFunc)(void* instance, void* context);
+
+        static const uint32_t kDefaultCapacity = 16;
+
+        /// deactivate parks a released or prewarmed instance (SetActive(false), reparent
+        /// under a pool root).
+        PrefabPool(InstantiateFunc instantiate, ActivateFunc activate, InstanceFunc deactivate, InstanceFunc destroy, void* context)
+            : m_Instantiate(instantiate), m_Activate(activate), m_Deactivate(deactivate), m_Destroy(destroy), m_Context(context)
+        {
+        }
+
+        ~PrefabPool()
+        {
+            Clear();
+        }
+
+        /// Sets how many inactive instances of prefab are kept; extra ones are destroyed.
+        void SetCapacity(void* prefab, uint32_t capacity)
+        {
+            Pool& pool = *m_Pools[GetPoolIndex(prefab)];
+            pool.capacity = capacity;
+            Trim(pool);
+        }
+
+        /// Instantiates inactive instances until count are pooled. Raises the capacity if
+        /// it is lower than count.
+        void Prewarm(void* prefab, uint32_t count)
+        {
+            Pool& pool = *m_Pools[GetPoolIndex(prefab)];
+            if (pool.capacity < count)
+                pool.capacity = count;
+
+            while (pool.instances.size() < count)
+            {
+                void* instance = m_Instantiate(prefab, m_Context);
+                if (instance == NULL)
+                    return;
+
+                m_Deactivate(instance, m_Context);
+                pool.instances.push_back(instance);
+            }
+        }
+
+        /// Object.Instantiate(prefab, position, rotation, parent) through the pool.
+        void* Spawn(void* prefab, const Placement& placement)
+        {
+            uint32_t poolIndex = GetPoolIndex(prefab);
+            Pool& pool = *m_Pools[poolIndex];
+
+            void* instance;
+            if (!pool.instances.empty())
+            {
+                pool.hitCount++;
+                instance = pool.instances.back();
+                pool.instances.pop_back();
+            }
+            else
+            {
+                pool.missCount++;
+                instance = m_Instantiate(prefab, m_Context);
+                if (instance == NULL)
+                    return NULL;
+            }
+
+            m_Owners[instance] = poolIndex;
+            pool.activeCount++;
+            m_Activate(instance, placement, m_Context);
+            return instance;
+        }
+
+        /// Object.Destroy(instance) through the pool. Instances the pool did not spawn are
+        /// destroyed outright and false is returned.
+        bool Release(void* instance)
+        {
+            IndexMap::iterator it = m_Owners.find(instance);
+            if (it == m_Owners.end())
+            {
+                m_Destroy(instance, m_Context);
+                return false;
+            }
+
+            Pool& pool = *m_Pools[it->second];
+            m_Owners.erase(it);
+            pool.activeCount--;
+            pool.releaseCount++;
+
+            if (pool.instances.size() >= pool.capacity)
+            {
+                pool.destroyCount++;
+                m_Destroy(instance, m_Context);
+                return true;
+            }
+
+            m_Deactivate(instance, m_Context);
+            pool.instances.push_back(instance);
+            return true;
+        }
+
+        Statistics GetStatistics(void* prefab) const
+        {
+            Statistics stats = {};
+            IndexMap::const_iterator it = m_PoolIndices.find(prefab);
+            if (it == m_PoolIndices.end())
+                return stats;
+
+            const Pool& pool = *m_Pools[it->second];
+            stats.hitCount = pool.hitCount;
+            stats.missCount = pool.missCount;
+            stats.releaseCount = pool.releaseCount;
+            stats.destroyCount = pool.destroyCount;
+            stats.pooledCount = pool.instances.size();
+            stats.activeCount = pool.activeCount;
+            return stats;
+        }
+
+        /// Destroys every pooled instance. Spawned instances stay alive and are destroyed
+        /// outright when released. The pools are detached before the first destroy
+        /// callback runs, so a callback that spawns or releases sees an empty pool.
+        void Clear()
+        {
+            std::vector<Pool*> pools;
+            pools.swap(m_Pools);
+            m_PoolIndices.clear();
+            m_Owners.clear();
+
+            for (size_t i = 0; i < pools.size(); i++)
+            {
+                for (size_t j = 0; j < pools[i]->instances.size(); j++)
+                    m_Destroy(pools[i]->instances[j], m_Context);
+                delete pools[i];
+            }
+        }
+
+    private:
+        struct Pool
+        {
+            std::vector<void*> instances;
+            uint32_t capacity;
+            size_t activeCount;
+            uint64_t hitCount;
+            uint64_t missCount;
+            uint64_t releaseCount;
+            uint64_t destroyCount;
+
+            Pool() : capacity(kDefaultCapacity), activeCount(0), hitCount(0), missCount(0), releaseCount(0), destroyCount(0) {}
+        };
+
+        typedef std::unordered_map<void*, uint32_t, il2cpp::utils::PassThroughHash<void*> > IndexMap;
+
+        uint32_t GetPoolIndex(void* prefab)
+        {
+            IndexMap::iterator it = m_PoolIndices.find(prefab);
+            if (it != m_PoolIndices.end())
+                return it->second;
+
+            uint32_t index = (uint32_t)m_Pools.size();
+            m_PoolIndices.insert(std::make_pair(prefab, index));
+            m_Pools.push_back(new Pool());
+            return index;
+        }
+
+        void Trim(Pool& pool)
+        {
+            while (pool.instances.size() > pool.capacity)
+            {
+                // Popped first, so a destroy callback that releases into this pool is safe.
+                void* instance = pool.instances.back();
+                pool.instances.pop_back();
+                pool.destroyCount++;
+                m_Destroy(instance, m_Context);
+            }
+        }
+
+        InstantiateFunc m_Instantiate;
+        ActivateFunc m_Activate;
+        InstanceFunc m_Deactivate;
+        InstanceFunc m_Destroy;
+        void* m_Context;
+
+        std::vector<Pool*> m_Pools;
+        IndexMap m_PoolIndices; // prefab -> index in m_Pools
+        IndexMap m_Owners;      // spawned instance -> index in m_Pools
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "os/Mutex.h"
+#include "os/Unity/UnityPlatformConfigure.h"
+#include "os/Unity/ExtendedAtomicOps.h"
+#include "utils/Memory.h"
+#include "utils/NonCopyable.h"
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Pointer to pointer hash map optimized for lookups that vastly outnumber inserts.
+///
+/// Readers never lock: they load the current table with acquire semantics and probe it.
+/// Writers are serialized by a FastMutex and either fill an empty slot in place (value
+/// first, then key with release semantics, so a reader that sees the key also sees the
+/// value) or publish a grown copy of the table. Entries are never removed, so a reader
+/// that is still probing a superseded table sees a consistent, if slightly stale, view.
+/// Superseded tables are kept until the map is destroyed since there is no way to know
+/// when the last reader has left them; as tables double in size that is at most the
+/// size of the current one again.
+///
+/// Key and Value must be pointer types; NULL is reserved as the empty key and as the
+/// "not found" value.
+    template<typename Key, typename Value>
+    class ReadMostlyPointerMap : public il2cpp::utils::NonCopyable
+    {
+    public:
+        ReadMostlyPointerMap()
+            : m_Table(AllocateTable(kInitialCapacity)), m_Count(0)
+        {
+        }
+
+        ~ReadMostlyPointerMap()
+        {
+            Table* table = m_Table;
+            while (table != NULL)
+            {
+                Table* retired = table->retired;
+                IL2CPP_FREE(table);
+                table = retired;
+            }
+        }
+
+        Value Get(Key key) const
+        {
+            IL2CPP_ASSERT(key != NULL);
+
+            void* rawKey = (void*)key;
+            const Table* table = static_cast<const Table*>(LoadAcquire(reinterpret_cast<void* const volatile*>(&m_Table)));
+            for (size_t index = Hash(rawKey) & table->mask;; index = (index + 1) & table->mask)
+            {
+                void* slotKey = LoadAcquire(&table->entries[index].key);
+                if (slotKey == rawKey)
+                    return (Value)LoadAcquire(&table->entries[index].value);
+                if (slotKey == NULL)
+                    return NULL;
+            }
+        }
+
+        /// Adds the key or replaces its value.
+        void Add(Key key, Value value)
+        {
+            IL2CPP_ASSERT(key != NULL);
+
+            il2cpp::os::FastAutoLock lock(&m_WriteMutex);
+
+            void* rawKey = (void*)key;
+            Table* table = m_Table;
+            Entry* entry = FindSlot(table, rawKey);
+            if (entry->key == rawKey)
+            {
+                StoreRelease(&entry->value, (void*)value);
+                return;
+            }
+
+            if ((m_Count + 1) * 4 > (table->mask + 1) * 3)
+            {
+                table = Grow(table);
+                entry = FindSlot(table, rawKey);
+            }
+
+            StoreRelease(&entry->value, (void*)value);
+            StoreRelease(&entry->key, rawKey);
+            m_Count++;
+        }
+
+        size_t Count() const
+        {
+            il2cpp::os::FastAutoLock lock(&m_WriteMutex);
+            return m_Count;
+        }
+
+    private:
+        struct Entry
+        {
+            void* volatile key;
+            void* volatile value;
+        };
+
+        struct Table
+        {
+            size_t mask;
+            Table* retired;
+            Entry entries[1];
+        };
+
+        static const size_t kInitialCapacity = 64;
+
+        static inline size_t Hash(void* key)
+        {
+            // Function and method pointers are aligned and clustered, so mix the bits before masking.
+            uint64_t value = (uint64_t)(uintptr_t)key;
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdULL;
+            value ^= value >> 33;
+            return (size_t)value;
+        }
+
+        static inline void* LoadAcquire(void* const volatile* location)
+        {
+            return (void*)il2cpp::os::atomic_load_explicit(reinterpret_cast<const volatile atomic_word*>(location), il2cpp::os::memory_order_acquire);
+        }
+
+        static inline void StoreRelease(void* volatile* location, void* value)
+        {
+            il2cpp::os::atomic_store_explicit(reinterpret_cast<volatile atomic_word*>(location), (atomic_word)value, il2cpp::os::memory_order_release);
+        }
+
+        static Table* AllocateTable(size_t capacity)
+        {
+            Table* table = static_cast<Table*>(IL2CPP_MALLOC_ZERO(sizeof(Table) + (capacity - 1) * sizeof(Entry)));
+            table->mask = capacity - 1;
+            return table;
+        }
+
+        static Entry* FindSlot(Table* table, void* key)
+        {
+            for (size_t index = Hash(key) & table->mask;; index = (index + 1) & table->mask)
+            {
+                Entry* entry = &table->entries[index];
+                if (entry->key == key || entry->key == NULL)
+                    return entry;
+            }
+        }
+
+        Table* Grow(Table* table)
+        {
+            Table* grown = AllocateTable((table->mask + 1) * 2);
+            for (size_t i = 0; i <= table->mask; i++)
+            {
+                if (table->entries[i].key == NULL)
+                    continue;
+
+                Entry* entry = FindSlot(grown, table->entries[i].key);
+                entry->key = table->entries[i].key;
+                entry->value = table->entries[i].value;
+            }
+
+            grown->retired = table;
+            StoreRelease(reinterpret_cast<void* volatile*>(&m_Table), grown);
+            return grown;
+        }
+
+        Table* volatile m_Table;
+        size_t m_Count;
+        mutable il2cpp::os::FastMutex m_WriteMutex;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
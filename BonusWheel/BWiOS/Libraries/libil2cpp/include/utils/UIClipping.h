@@ -0,0 +1,285 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/NonCopyable.h"
+#include <stdint.h>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define IL2CPP_UI_CLIPPING_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IL2CPP_UI_CLIPPING_SSE2 1
+#endif
+
+namespace il2cpp
+{
+namespace utils
+{
+    struct UIClipRect
+    {
+        float xMin, yMin, xMax, yMax;
+
+        bool operator==(const UIClipRect& other) const
+        {
+            return xMin == other.xMin && yMin == other.yMin && xMax == other.xMax && yMax == other.yMax;
+        }
+    };
+
+/// Rect kernels behind UnityEngine.UI.Clipping and MaskableGraphic.Cull.
+///
+/// Rects are held as min/max corners. Intersection folds them as (xMin, yMin, -xMax,
+/// -yMax), so the intersection of any number of rects is one vector max per rect, and a
+/// cull test is one vector compare per child.
+    class UIClipping
+    {
+    public:
+        /// Clipping.FindCullAndClipWorldRect: the intersection of the parent masks' canvas
+        /// rects. validRect is false for no parents or an empty intersection, in which case
+        /// the returned rect is all zeros as in the original.
+        static UIClipRect FindCullAndClipRect(const UIClipRect* rects, size_t count, bool* validRect)
+        {
+            UIClipRect result = { 0.0f, 0.0f, 0.0f, 0.0f };
+            if (count == 0)
+            {
+                *validRect = false;
+                return result;
+            }
+
+#if IL2CPP_UI_CLIPPING_SSE2
+            const __m128 flip = _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+            __m128 folded = _mm_xor_ps(_mm_loadu_ps(&rects[0].xMin), flip);
+            for (size_t i = 1; i < count; i++)
+                folded = _mm_max_ps(folded, _mm_xor_ps(_mm_loadu_ps(&rects[i].xMin), flip));
+
+            UIClipRect intersection;
+            _mm_storeu_ps(&intersection.xMin, _mm_xor_ps(folded, flip));
+#elif IL2CPP_UI_CLIPPING_NEON
+            const float32x4_t sign = { 1.0f, 1.0f, -1.0f, -1.0f };
+            float32x4_t folded = vmulq_f32(vld1q_f32(&rects[0].xMin), sign);
+            for (size_t i = 1; i < count; i++)
+                folded = vmaxq_f32(folded, vmulq_f32(vld1q_f32(&rects[i].xMin), sign));
+
+            UIClipRect intersection;
+            vst1q_f32(&intersection.xMin, vmulq_f32(folded, sign));
+#else
+            UIClipRect intersection = rects[0];
+            for (size_t i = 1; i < count; i++)
+            {
+                intersection.xMin = rects[i].xMin > intersection.xMin ? rects[i].xMin : intersection.xMin;
+                intersection.yMin = rects[i].yMin > intersection.yMin ? rects[i].yMin : intersection.yMin;
+                intersection.xMax = rects[i].xMax < intersection.xMax ? rects[i].xMax : intersection.xMax;
+                intersection.yMax = rects[i].yMax < intersection.yMax ? rects[i].yMax : intersection.yMax;
+            }
+#endif
+
+            *validRect = intersection.xMax > intersection.xMin && intersection.yMax > intersection.yMin;
+            return *validRect ? intersection : result;
+        }
+
+        /// MaskableGraphic.Cull for a batch of children: culled[i] is 1 when the clip rect is
+        /// invalid or does not overlap rects[i].
+        static void CullRects(const UIClipRect& clipRect, bool validRect, const UIClipRect* rects, size_t count, uint8_t* culled)
+        {
+            if (!validRect)
+            {
+                for (size_t i = 0; i < count; i++)
+                    culled[i] = 1;
+                return;
+            }
+
+#if IL2CPP_UI_CLIPPING_SSE2
+            // Overlap is clip.min < child.max and child.min < clip.max on both axes, i.e.
+            // (clip.xMin, clip.yMin, child.xMin, child.yMin) < (child.xMax, child.yMax, clip.xMax, clip.yMax).
+            const __m128 clipMin = _mm_set_ps(0.0f, 0.0f, clipRect.yMin, clipRect.xMin);
+            const __m128 clipMax = _mm_set_ps(clipRect.yMax, clipRect.xMax, 0.0f, 0.0f);
+            for (size_t i = 0; i < count; i++)
+            {
+                __m128 child = _mm_loadu_ps(&rects[i].xMin);
+                __m128 left = _mm_or_ps(clipMin, _mm_movelh_ps(_mm_setzero_ps(), child));
+                __m128 right = _mm_or_ps(clipMax, _mm_movehl_ps(_mm_setzero_ps(), child));
+                culled[i] = _mm_movemask_ps(_mm_cmplt_ps(left, right)) != 0xF;
+            }
+#elif IL2CPP_UI_CLIPPING_NEON
+            const float32x2_t clipMin = vld1_f32(&clipRect.xMin);
+            const float32x2_t clipMax = vld1_f32(&clipRect.xMax);
+            for (size_t i = 0; i < count; i++)
+            {
+                float32x4_t child = vld1q_f32(&rects[i].xMin);
+                float32x4_t left = vcombine_f32(clipMin, vget_low_f32(child));
+                float32x4_t right = vcombine_f32(vget_high_f32(child), clipMax);
+                uint32x4_t overlap = vcltq_f32(left, right);
+                uint32x2_t folded = vand_u32(vget_low_u32(overlap), vget_high_u32(overlap));
+                culled[i] = (vget_lane_u32(folded, 0) & vget_lane_u32(folded, 1)) == 0;
+            }
+#else
+            for (size_t i = 0; i < count; i++)
+            {
+                const UIClipRect& child = rects[i];
+                bool overlaps = clipRect.xMin < child.xMax && clipRect.yMin < child.yMax && child.xMin < clipRect.xMax && child.yMin < clipRect.yMax;
+                culled[i] = !overlaps;
+            }
+#endif
+        }
+    };
+
+/// Per RectMask2D state for ClipperRegistry.Cull.
+///
+/// RectMask2D.PerformClipping recomputes the clip rect from all parent masks every frame
+/// and pushes the clip rect and cull state to each child through one CanvasRenderer call
+/// per child. UIRectClipper keeps the last clip rect and the children's canvas rects and
+/// cull flags. Only when the clip rect or validity changed are all children touched;
+/// otherwise only the children whose rect moved are re-tested, and an unchanged mask does
+/// no work at all. PerformClipping returns the list of children whose state has to be
+/// pushed. CanvasRenderer has no call that takes several renderers, so the caller still
+/// makes one SetClipRect or cull call per listed child; what is saved is the calls for
+/// the children that did not change, not the per-call cost.
+    class UIRectClipper : public il2cpp::utils::NonCopyable
+    {
+    public:
+        struct Change
+        {
+            void* target;
+            bool culled;
+            bool clipRectChanged;   // SetClipRect is needed besides the cull flag
+        };
+
+        UIRectClipper() : m_ClipRectValid(false), m_HasClipRect(false), m_ForceAll(true)
+        {
+            UIClipRect empty = { 0.0f, 0.0f, 0.0f, 0.0f };
+            m_ClipRect = empty;
+        }
+
+        /// Returns the child's index, which stays valid until it is removed. Removal swaps
+        /// the last child into the freed index, so the caller must re-read indices from
+        /// GetChildTarget or track the move reported by RemoveChild.
+        uint32_t AddChild(void* target, const UIClipRect& canvasRect)
+        {
+            m_Targets.push_back(target);
+            m_Rects.push_back(canvasRect);
+            m_Culled.push_back(0);
+            m_Dirty.push_back(kDirtyNew);
+            m_DirtyChildren.push_back((uint32_t)m_Targets.size() - 1);
+            return (uint32_t)m_Targets.size() - 1;
+        }
+
+        /// Removes the child at index and returns the target moved into its place, or NULL.
+        void* RemoveChild(uint32_t index)
+        {
+            uint32_t last = (uint32_t)m_Targets.size() - 1;
+            void* moved = NULL;
+            if (index != last)
+            {
+                moved = m_Targets[last];
+                m_Targets[index] = m_Targets[last];
+                m_Rects[index] = m_Rects[last];
+                m_Culled[index] = m_Culled[last];
+                m_Dirty[index] = m_Dirty[last];
+            }
+
+            m_Targets.pop_back();
+            m_Rects.pop_back();
+            m_Culled.pop_back();
+            m_Dirty.pop_back();
+
+            // Pending indices may now be stale; re-testing everything once is cheap and rare.
+            m_ForceAll = true;
+            return moved;
+        }
+
+        void SetChildRect(uint32_t index, const UIClipRect& canvasRect)
+        {
+            if (m_Rects[index] == canvasRect)
+                return;
+
+            m_Rects[index] = canvasRect;
+            if (m_Dirty[index] == kClean)
+            {
+                m_Dirty[index] = kDirtyRect;
+                m_DirtyChildren.push_back(index);
+            }
+        }
+
+        void* GetChildTarget(uint32_t index) const { return m_Targets[index]; }
+        size_t GetChildCount() const { return m_Targets.size(); }
+        const UIClipRect& GetClipRect() const { return m_ClipRect; }
+        bool IsClipRectValid() const { return m_ClipRectValid; }
+
+        /// Intersects the parent mask rects and re-culls the children that need it. The
+        /// returned list is reused by the next call.
+        const std::vector<Change>& PerformClipping(const UIClipRect* parentRects, size_t parentCount)
+        {
+            m_Changes.clear();
+
+            bool validRect;
+            UIClipRect clipRect = UIClipping::FindCullAndClipRect(parentRects, parentCount, &validRect);
+            bool clipChanged = !m_HasClipRect || validRect != m_ClipRectValid || !(clipRect == m_ClipRect);
+            m_ClipRect = clipRect;
+            m_ClipRectValid = validRect;
+            m_HasClipRect = true;
+
+            if (clipChanged || m_ForceAll)
+            {
+                m_Scratch.resize(m_Targets.size());
+                if (!m_Targets.empty())
+                    UIClipping::CullRects(clipRect, validRect, &m_Rects[0], m_Targets.size(), &m_Scratch[0]);
+
+                for (size_t i = 0; i < m_Targets.size(); i++)
+                {
+                    bool isNew = m_Dirty[i] == kDirtyNew;
+                    if (clipChanged || isNew || m_Scratch[i] != m_Culled[i])
+                        PushChange((uint32_t)i, m_Scratch[i] != 0, clipChanged || isNew);
+                    m_Culled[i] = m_Scratch[i];
+                    m_Dirty[i] = kClean;
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < m_DirtyChildren.size(); i++)
+                {
+                    uint32_t index = m_DirtyChildren[i];
+                    uint8_t culled;
+                    UIClipping::CullRects(clipRect, validRect, &m_Rects[index], 1, &culled);
+                    bool isNew = m_Dirty[index] == kDirtyNew;
+                    if (isNew || culled != m_Culled[index])
+                        PushChange(index, culled != 0, isNew);
+                    m_Culled[index] = culled;
+                    m_Dirty[index] = kClean;
+                }
+            }
+
+            m_DirtyChildren.clear();
+            m_ForceAll = false;
+            return m_Changes;
+        }
+
+    private:
+        enum DirtyState
+        {
+            kClean,
+            kDirtyRect,
+            kDirtyNew       // never pushed, so it needs its clip rect as well
+        };
+
+        void PushChange(uint32_t index, bool culled, bool clipRectChanged)
+        {
+            Change change = { m_Targets[index], culled, clipRectChanged };
+            m_Changes.push_back(change);
+        }
+
+        std::vector<void*> m_Targets;
+        std::vector<UIClipRect> m_Rects;
+        std::vector<uint8_t> m_Culled;
+        std::vector<uint8_t> m_Dirty;         // DirtyState
+        std::vector<uint32_t> m_DirtyChildren;
+        std::vector<uint8_t> m_Scratch;
+        std::vector<Change> m_Changes;
+
+        UIClipRect m_ClipRect;
+        bool m_ClipRectValid;
+        bool m_HasClipRect;
+        bool m_ForceAll;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
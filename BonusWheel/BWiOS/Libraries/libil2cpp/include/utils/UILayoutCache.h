@@ -0,0 +1,239 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/HashUtils.h"
+#include "utils/NonCopyable.h"
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Per RectTransform memo for UnityEngine.UI.LayoutRebuilder.
+///
+/// LayoutRebuilder.Rebuild walks the whole subtree twice and at every node fetches the
+/// ILayoutElement or ILayoutController components into a pooled list and strips the
+/// disabled ones, then asks every layout element for its sizes again. The cache keeps
+/// both component lists per node until InvalidateComponents (a component was added,
+/// removed, enabled or disabled), and memoizes the sizes each node's
+/// CalculateLayoutInputHorizontal/Vertical produced.
+///
+/// Sizes are invalidated bottom-up: MarkDirty clears a node and its ancestors, whose sizes
+/// depend on it, so when one leaf changes only the path to the root is recalculated and
+/// every untouched sibling subtree reuses its memoized sizes.
+///
+/// Entries are allocated one by one and never move, so the lists returned by
+/// GetLayoutElements and GetLayoutControllers can be held while the children are visited
+/// (PerformLayoutCalculation recurses between fetching and using them). A list stays at
+/// its address until Clear or the cache's destruction. Its contents change only when the
+/// node's components are collected again after InvalidateComponents, or when the node is
+/// forgotten, which empties it.
+    class UILayoutCache : public il2cpp::utils::NonCopyable
+    {
+    public:
+        enum Axis
+        {
+            kHorizontal = 0,
+            kVertical = 1
+        };
+
+        struct LayoutSizes
+        {
+            float minSize;
+            float preferredSize;
+            float flexibleSize;
+        };
+
+        /// Fills the enabled ILayoutElement and ILayoutController components of node.
+        typedef void (*CollectComponentsFunc)(void* node, std::vector<void*>& layoutElements, std::vector<void*>& layoutControllers, void* context);
+
+        UILayoutCache(CollectComponentsFunc collectComponents, void* context)
+            : m_CollectComponents(collectComponents), m_Context(context), m_ComponentHits(0), m_ComponentMisses(0), m_SizeHits(0), m_SizeMisses(0)
+        {
+        }
+
+        ~UILayoutCache()
+        {
+            Clear();
+        }
+
+        const std::vector<void*>& GetLayoutElements(void* node)
+        {
+            return EnsureComponents(GetEntry(node)).layoutElements;
+        }
+
+        const std::vector<void*>& GetLayoutControllers(void* node)
+        {
+            return EnsureComponents(GetEntry(node)).layoutControllers;
+        }
+
+        /// A layout component on node was added, removed, enabled or disabled. Its sizes
+        /// change with it, so the node is marked dirty as well.
+        void InvalidateComponents(void* node)
+        {
+            NodeMap::iterator it = m_Nodes.find(node);
+            if (it == m_Nodes.end())
+                return;
+
+            m_Entries[it->second]->componentsValid = false;
+            MarkDirty(node);
+        }
+
+        /// Records node's parent for dirty propagation. Re-parenting dirties both the old
+        /// and the new ancestors.
+        void SetParent(void* node, void* parent)
+        {
+            uint32_t index = GetEntry(node);
+            if (m_Entries[index]->parent == parent)
+                return;
+
+            MarkDirty(node);
+            m_Entries[index]->parent = parent;
+            MarkDirty(node);
+        }
+
+        bool TryGetSizes(void* node, Axis axis, LayoutSizes* sizes)
+        {
+            NodeMap::iterator it = m_Nodes.find(node);
+            if (it == m_Nodes.end() || !m_Entries[it->second]->sizesValid[axis])
+            {
+                m_SizeMisses++;
+                return false;
+            }
+
+            m_SizeHits++;
+            *sizes = m_Entries[it->second]->sizes[axis];
+            return true;
+        }
+
+        /// Stores the sizes CalculateLayoutInput computed for node on one axis.
+        void StoreSizes(void* node, Axis axis, const LayoutSizes& sizes)
+        {
+            Entry& entry = *m_Entries[GetEntry(node)];
+            entry.sizes[axis] = sizes;
+            entry.sizesValid[axis] = true;
+        }
+
+        /// LayoutRebuilder.MarkLayoutForRebuild for a node whose own layout input changed.
+        void MarkDirty(void* node)
+        {
+            for (NodeMap::iterator it = m_Nodes.find(node); it != m_Nodes.end(); it = m_Nodes.find(m_Entries[it->second]->parent))
+            {
+                Entry& entry = *m_Entries[it->second];
+                entry.sizesValid[kHorizontal] = false;
+                entry.sizesValid[kVertical] = false;
+                if (entry.parent == NULL)
+                    return;
+            }
+        }
+
+        /// Drops a destroyed node; its ancestors are dirtied since they lose a child.
+        void Forget(void* node)
+        {
+            NodeMap::iterator it = m_Nodes.find(node);
+            if (it == m_Nodes.end())
+                return;
+
+            uint32_t index = it->second;
+            MarkDirty(node);
+            m_Nodes.erase(node);
+
+            Entry& entry = *m_Entries[index];
+            entry.node = NULL;
+            entry.parent = NULL;
+            entry.layoutElements.clear();
+            entry.layoutControllers.clear();
+            m_FreeEntries.push_back(index);
+        }
+
+        /// Frees every entry; lists returned earlier must not be used afterwards.
+        void Clear()
+        {
+            for (size_t i = 0; i < m_Entries.size(); i++)
+                delete m_Entries[i];
+
+            m_Nodes.clear();
+            m_Entries.clear();
+            m_FreeEntries.clear();
+        }
+
+        uint64_t GetComponentHitCount() const { return m_ComponentHits; }
+        uint64_t GetComponentMissCount() const { return m_ComponentMisses; }
+        uint64_t GetSizeHitCount() const { return m_SizeHits; }
+        uint64_t GetSizeMissCount() const { return m_SizeMisses; }
+
+    private:
+        struct Entry
+        {
+            void* node;
+            void* parent;
+            bool componentsValid;
+            bool sizesValid[2];
+            LayoutSizes sizes[2];
+            std::vector<void*> layoutElements;
+            std::vector<void*> layoutControllers;
+        };
+
+        typedef std::unordered_map<void*, uint32_t, il2cpp::utils::PassThroughHash<void*> > NodeMap;
+
+        uint32_t GetEntry(void* node)
+        {
+            NodeMap::iterator it = m_Nodes.find(node);
+            if (it != m_Nodes.end())
+                return it->second;
+
+            uint32_t index;
+            if (!m_FreeEntries.empty())
+            {
+                index = m_FreeEntries.back();
+                m_FreeEntries.pop_back();
+            }
+            else
+            {
+                index = (uint32_t)m_Entries.size();
+                m_Entries.push_back(new Entry());
+            }
+
+            Entry& entry = *m_Entries[index];
+            entry.node = node;
+            entry.parent = NULL;
+            entry.componentsValid = false;
+            entry.sizesValid[kHorizontal] = false;
+            entry.sizesValid[kVertical] = false;
+            m_Nodes.insert(std::make_pair(node, index));
+            return index;
+        }
+
+        Entry& EnsureComponents(uint32_t index)
+        {
+            Entry& entry = *m_Entries[index];
+            if (entry.componentsValid)
+            {
+                m_ComponentHits++;
+                return entry;
+            }
+
+            m_ComponentMisses++;
+            entry.layoutElements.clear();
+            entry.layoutControllers.clear();
+            m_CollectComponents(entry.node, entry.layoutElements, entry.layoutControllers, m_Context);
+            entry.componentsValid = true;
+            return entry;
+        }
+
+        CollectComponentsFunc m_CollectComponents;
+        void* m_Context;
+
+        NodeMap m_Nodes;
+        std::vector<Entry*> m_Entries;
+        std::vector<uint32_t> m_FreeEntries;
+
+        uint64_t m_ComponentHits;
+        uint64_t m_ComponentMisses;
+        uint64_t m_SizeHits;
+        uint64_t m_SizeMisses;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
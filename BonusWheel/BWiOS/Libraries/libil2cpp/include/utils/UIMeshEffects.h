@@ -0,0 +1,169 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/UIVertex.h"
+#include <string.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define IL2CPP_UI_MESH_EFFECTS_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IL2CPP_UI_MESH_EFFECTS_SSE2 1
+#endif
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Single pass kernels for UnityEngine.UI.Shadow and Outline.
+///
+/// Shadow.ApplyShadowZeroAlloc appends a copy of the vertex range and rewrites the
+/// original range as the shadow; Outline runs it four times, each time over the copy the
+/// previous pass appended, so every vertex is read and written through List<UIVertex>
+/// indexers roughly ten times. The end result is always the same layout, one block per
+/// offset followed by the untouched source:
+///
+///     [shadow 0][shadow 1]...[shadow n-1][source]
+///
+/// ApplyShadows produces exactly that in place in one pass over the source, reading each
+/// vertex once and writing every copy from registers. The vertex is moved as four 16 byte
+/// vectors plus a 12 byte tail, with the position offset added to the first vector and
+/// the color word replaced in the third (SSE2 or NEON, with a scalar fallback).
+    class UIMeshEffects
+    {
+    public:
+        static const size_t kMaxOffsets = 4;
+
+        /// vertices holds count source vertices and must have room for
+        /// count * (offsetCount + 1). With useGraphicAlpha the shadow alpha is scaled by each
+        /// source vertex's alpha, as in Shadow.
+        static void ApplyShadows(UIVertex* vertices, size_t count, const UIVector2* offsets, size_t offsetCount, UIColor32 color, bool useGraphicAlpha)
+        {
+            IL2CPP_ASSERT(offsetCount >= 1 && offsetCount <= kMaxOffsets);
+
+            // Shadow blocks at index k * count for k >= 1 and the source copy at the end never
+            // overlap the source, and block 0 rewrites vertex i only after it has been read.
+            UIVertex* source = vertices + offsetCount * count;
+            for (size_t i = 0; i < count; i++)
+            {
+                UIColor32 shadowColor = color;
+                if (useGraphicAlpha)
+                    shadowColor.a = (uint8_t)((color.a * vertices[i].color.a) / 255);
+
+                uint32_t colorBits;
+                memcpy(&colorBits, &shadowColor, sizeof(colorBits));
+
+                EmitVertex(vertices + i, source + i, vertices, i, count, offsets, offsetCount, colorBits);
+            }
+        }
+
+        /// Shadow.ModifyMesh: one copy offset by distance.
+        static void ApplyShadow(UIVertex* vertices, size_t count, UIVector2 distance, UIColor32 color, bool useGraphicAlpha)
+        {
+            ApplyShadows(vertices, count, &distance, 1, color, useGraphicAlpha);
+        }
+
+        /// Outline.ModifyMesh: copies at (x, y), (x, -y), (-x, y) and (-x, -y), in that order.
+        static void ApplyOutline(UIVertex* vertices, size_t count, UIVector2 distance, UIColor32 color, bool useGraphicAlpha)
+        {
+            UIVector2 offsets[4] =
+            {
+                { distance.x, distance.y },
+                { distance.x, -distance.y },
+                { -distance.x, distance.y },
+                { -distance.x, -distance.y }
+            };
+            ApplyShadows(vertices, count, offsets, 4, color, useGraphicAlpha);
+        }
+
+    private:
+        // UIVertex is 19 words: position.xyz normal.x | normal.yz tangent.xy | tangent.zw color uv0.x | uv0.y uv1 uv2.x | uv2.y uv3
+
+#if IL2CPP_UI_MESH_EFFECTS_SSE2
+        static IL2CPP_FORCE_INLINE void EmitVertex(const UIVertex* input, UIVertex* sourceCopy, UIVertex* vertices, size_t index, size_t count, const UIVector2* offsets, size_t offsetCount, uint32_t colorBits)
+        {
+            const float* in = reinterpret_cast<const float*>(input);
+            __m128 v0 = _mm_loadu_ps(in);
+            __m128 v1 = _mm_loadu_ps(in + 4);
+            __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 8));
+            __m128 v3 = _mm_loadu_ps(in + 12);
+            __m128i tail01 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + 16));
+            float tail2 = in[18];
+
+            Store(reinterpret_cast<float*>(sourceCopy), v0, v1, v2, v3, tail01, tail2);
+
+            // Swap the color word (lane 2 of the third vector) for the shadow color.
+            const __m128i colorMask = _mm_set_epi32(0, -1, 0, 0);
+            __m128i shadowV2 = _mm_or_si128(_mm_andnot_si128(colorMask, v2), _mm_and_si128(colorMask, _mm_set1_epi32((int32_t)colorBits)));
+
+            for (size_t k = 0; k < offsetCount; k++)
+            {
+                __m128 shadowV0 = _mm_add_ps(v0, _mm_set_ps(0.0f, 0.0f, offsets[k].y, offsets[k].x));
+                Store(reinterpret_cast<float*>(vertices + k * count + index), shadowV0, v1, shadowV2, v3, tail01, tail2);
+            }
+        }
+
+        static IL2CPP_FORCE_INLINE void Store(float* out, __m128 v0, __m128 v1, __m128i v2, __m128 v3, __m128i tail01, float tail2)
+        {
+            _mm_storeu_ps(out, v0);
+            _mm_storeu_ps(out + 4, v1);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), v2);
+            _mm_storeu_ps(out + 12, v3);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 16), tail01);
+            out[18] = tail2;
+        }
+
+#elif IL2CPP_UI_MESH_EFFECTS_NEON
+        static IL2CPP_FORCE_INLINE void EmitVertex(const UIVertex* input, UIVertex* sourceCopy, UIVertex* vertices, size_t index, size_t count, const UIVector2* offsets, size_t offsetCount, uint32_t colorBits)
+        {
+            const float* in = reinterpret_cast<const float*>(input);
+            float32x4_t v0 = vld1q_f32(in);
+            float32x4_t v1 = vld1q_f32(in + 4);
+            uint32x4_t v2 = vld1q_u32(reinterpret_cast<const uint32_t*>(in + 8));
+            float32x4_t v3 = vld1q_f32(in + 12);
+            float32x2_t tail01 = vld1_f32(in + 16);
+            float tail2 = in[18];
+
+            Store(reinterpret_cast<float*>(sourceCopy), v0, v1, v2, v3, tail01, tail2);
+
+            uint32x4_t shadowV2 = vsetq_lane_u32(colorBits, v2, 2);
+
+            for (size_t k = 0; k < offsetCount; k++)
+            {
+                float32x2_t offset = vld1_f32(&offsets[k].x);
+                float32x4_t shadowV0 = vaddq_f32(v0, vcombine_f32(offset, vdup_n_f32(0.0f)));
+                Store(reinterpret_cast<float*>(vertices + k * count + index), shadowV0, v1, shadowV2, v3, tail01, tail2);
+            }
+        }
+
+        static IL2CPP_FORCE_INLINE void Store(float* out, float32x4_t v0, float32x4_t v1, uint32x4_t v2, float32x4_t v3, float32x2_t tail01, float tail2)
+        {
+            vst1q_f32(out, v0);
+            vst1q_f32(out + 4, v1);
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + 8), v2);
+            vst1q_f32(out + 12, v3);
+            vst1_f32(out + 16, tail01);
+            out[18] = tail2;
+        }
+
+#else
+        static IL2CPP_FORCE_INLINE void EmitVertex(const UIVertex* input, UIVertex* sourceCopy, UIVertex* vertices, size_t index, size_t count, const UIVector2* offsets, size_t offsetCount, uint32_t colorBits)
+        {
+            UIVertex vertex = *input;
+            *sourceCopy = vertex;
+
+            memcpy(&vertex.color, &colorBits, sizeof(colorBits));
+            float x = vertex.position.x;
+            float y = vertex.position.y;
+            for (size_t k = 0; k < offsetCount; k++)
+            {
+                vertex.position.x = x + offsets[k].x;
+                vertex.position.y = y + offsets[k].y;
+                vertices[k * count + index] = vertex;
+            }
+        }
+#endif
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
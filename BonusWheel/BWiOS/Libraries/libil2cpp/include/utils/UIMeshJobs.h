@@ -0,0 +1,243 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "os/Atomic.h"
+#include "os/Environment.h"
+#include "os/Event.h"
+#include "os/Semaphore.h"
+#include "os/Thread.h"
+#include "utils/NonCopyable.h"
+#include "utils/UIVertexBuffer.h"
+#include "vm/Domain.h"
+#include "vm/Thread.h"
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Parallel mesh generation for the graphic rebuild pass of a canvas.
+///
+/// Graphic.Rebuild runs UpdateGeometry, and with it OnPopulateMesh, for one dirty
+/// Graphic after another on the main thread. Generate instead hands each Graphic to a
+/// small pool of worker threads, which fill one UIVertexBuffer per Graphic. The main
+/// thread takes a share of the jobs itself and, once every job is done, submits the
+/// buffers to the CanvasRenderers in the original order, so only the submission stays
+/// serial.
+///
+/// The generate callback must only read and write state owned by its Graphic and its
+/// buffer: no CanvasRenderer or other engine calls, no shared caches, and no exceptions
+/// escaping it. Workers are attached to the VM, so managed code that honours that can run
+/// on them. Batches smaller than the parallel threshold run inline on the caller.
+///
+/// The stock OnPopulateMesh implementations do not honour that as they are: they read
+/// RectTransform.rect and GetPixelAdjustedRect, and Image reads the Sprite's geometry,
+/// all of which are main thread engine calls. The prefetch callback runs on the calling
+/// thread for every Graphic, in order, before any job starts. It copies those inputs into
+/// state the Graphic owns, so that generate only reads copies. It returns false for a
+/// Graphic that cannot be generated that way. Generate then runs that Graphic's generate
+/// callback on the calling thread during the prefetch, and only the others go to the
+/// workers. In UnityEngine.UI:
+/// - Qualify once their inputs are prefetched: RawImage (rect, color, uvRect); Image with
+///   a Simple, Sliced, Tiled or Filled sprite (rect, color, the sprite's outer and inner
+///   UVs, border, rect and pixelsPerUnit, and the canvas reference pixels per unit);
+///   Graphics whose OnPopulateMesh only uses their rect and color.
+/// - Do not qualify: Text, since TextGenerator.Populate and Font.RequestCharactersInTexture
+///   update the shared font atlas on the main thread; Image with useSpriteMesh; and any
+///   Graphic whose IMeshModifier components do more than transform the vertices.
+///
+/// Text is therefore out of scope, even though it is usually the most expensive Graphic
+/// to rebuild: its prefetch always returns false and it costs what it did before.
+///
+/// kDefaultParallelThreshold is 8 because handing a batch to the workers costs a
+/// semaphore post per worker, their wake-ups and a final event wait, tens of
+/// microseconds on a phone, while a Simple or Sliced Image generates its 4 to 36
+/// vertices in about a microsecond. Below eight qualifying Graphics the hand-off costs
+/// more than it saves, so small rebuilds such as the claim screen's two Graphics run
+/// inline on purpose. Callers that know their Graphics are expensive can pass a lower
+/// threshold.
+    class UIMeshJobs : public il2cpp::utils::NonCopyable
+    {
+    public:
+        typedef void (*GenerateFunc)(void* graphic, UIVertexBuffer& buffer, void* context);
+
+        /// Runs on the calling thread; returns false to generate the Graphic there too.
+        typedef bool (*PrefetchFunc)(void* graphic, void* context);
+
+        static const uint32_t kMaxWorkers = 8;
+        static const size_t kDefaultParallelThreshold = 8;
+
+        /// workerCount 0 uses one worker per core other than the caller's.
+        explicit UIMeshJobs(uint32_t workerCount = 0, size_t parallelThreshold = kDefaultParallelThreshold)
+            : m_RequestedWorkers(workerCount), m_ParallelThreshold(parallelThreshold), m_WorkAvailable(0, kMaxWorkers),
+            m_Graphics(NULL), m_Generate(NULL), m_Context(NULL), m_NextJob(0), m_BusyWorkers(0), m_Stopping(0)
+        {
+        }
+
+        ~UIMeshJobs()
+        {
+            StopWorkers();
+            for (size_t i = 0; i < m_Buffers.size(); i++)
+                delete m_Buffers[i];
+        }
+
+        /// Generates graphics[i] into GetBuffer(i) for every i and returns when all are done.
+        /// Every Graphic is assumed to be safe to generate off the calling thread.
+        void Generate(void* const* graphics, size_t count, GenerateFunc generate, void* context)
+        {
+            Generate(graphics, count, NULL, generate, context);
+        }
+
+        /// As above, with prefetch called first for each Graphic on the calling thread.
+        void Generate(void* const* graphics, size_t count, PrefetchFunc prefetch, GenerateFunc generate, void* context)
+        {
+            while (m_Buffers.size() < count)
+                m_Buffers.push_back(new UIVertexBuffer());
+
+            m_Jobs.clear();
+            for (size_t i = 0; i < count; i++)
+            {
+                if (prefetch == NULL || prefetch(graphics[i], context))
+                {
+                    m_Jobs.push_back((uint32_t)i);
+                    continue;
+                }
+
+                m_Buffers[i]->Clear();
+                generate(graphics[i], *m_Buffers[i], context);
+            }
+
+            m_Graphics = graphics;
+            m_Generate = generate;
+            m_Context = context;
+            m_NextJob = 0;
+
+            if (m_Jobs.size() < m_ParallelThreshold || !StartWorkers())
+            {
+                RunJobs();
+                return;
+            }
+
+            int32_t workers = (int32_t)m_Workers.size();
+            os::Atomic::Exchange(&m_BusyWorkers, workers);
+            m_WorkAvailable.Post(workers);
+
+            RunJobs();
+
+            // Every posted worker runs the job loop once, even if the caller already drained
+            // it, so nothing from this batch is touched after Generate returns.
+            m_AllWorkersIdle.Wait();
+        }
+
+        UIVertexBuffer& GetBuffer(size_t index)
+        {
+            return *m_Buffers[index];
+        }
+
+        uint32_t GetWorkerCount() const
+        {
+            return (uint32_t)m_Workers.size();
+        }
+
+    private:
+        static void WorkerMain(void* arg)
+        {
+            UIMeshJobs* jobs = static_cast<UIMeshJobs*>(arg);
+            Il2CppThread* thread = vm::Thread::Attach(vm::Domain::GetRoot());
+
+            for (;;)
+            {
+                jobs->m_WorkAvailable.Wait();
+                if (os::Atomic::CompareExchange(&jobs->m_Stopping, 0, 0) != 0)
+                    break;
+
+                jobs->RunJobs();
+                if (os::Atomic::Decrement(&jobs->m_BusyWorkers) == 0)
+                    jobs->m_AllWorkersIdle.Set();
+            }
+
+            vm::Thread::Detach(thread);
+        }
+
+        void RunJobs()
+        {
+            for (;;)
+            {
+                int32_t job = os::Atomic::Increment(&m_NextJob) - 1;
+                if ((size_t)job >= m_Jobs.size())
+                    return;
+
+                uint32_t index = m_Jobs[job];
+                UIVertexBuffer& buffer = *m_Buffers[index];
+                buffer.Clear();
+                m_Generate(m_Graphics[index], buffer, m_Context);
+            }
+        }
+
+        bool StartWorkers()
+        {
+#if IL2CPP_SUPPORT_THREADS
+            if (!m_Workers.empty())
+                return true;
+
+            uint32_t workerCount = m_RequestedWorkers;
+            if (workerCount == 0)
+            {
+                int32_t processors = os::Environment::GetProcessorCount();
+                workerCount = processors > 1 ? (uint32_t)(processors - 1) : 0;
+            }
+            if (workerCount > kMaxWorkers)
+                workerCount = kMaxWorkers;
+
+            for (uint32_t i = 0; i < workerCount; i++)
+            {
+                os::Thread* worker = new os::Thread();
+                worker->SetName("il2cpp UI mesh worker");
+                if (worker->Run(WorkerMain, this) != os::kErrorCodeSuccess)
+                {
+                    delete worker;
+                    break;
+                }
+                m_Workers.push_back(worker);
+            }
+
+            return !m_Workers.empty();
+#else
+            return false;
+#endif
+        }
+
+        void StopWorkers()
+        {
+            if (m_Workers.empty())
+                return;
+
+            os::Atomic::Exchange(&m_Stopping, 1);
+            m_WorkAvailable.Post((int32_t)m_Workers.size());
+            for (size_t i = 0; i < m_Workers.size(); i++)
+            {
+                m_Workers[i]->Join();
+                delete m_Workers[i];
+            }
+            m_Workers.clear();
+        }
+
+        uint32_t m_RequestedWorkers;
+        size_t m_ParallelThreshold;
+        std::vector<os::Thread*> m_Workers;
+        std::vector<UIVertexBuffer*> m_Buffers;
+
+        os::Semaphore m_WorkAvailable;
+        os::Event m_AllWorkersIdle;
+
+        void* const* m_Graphics;
+        std::vector<uint32_t> m_Jobs;   // indices in m_Graphics to generate on the workers
+        GenerateFunc m_Generate;
+        void* m_Context;
+
+        volatile int32_t m_NextJob;
+        volatile int32_t m_BusyWorkers;
+        volatile int32_t m_Stopping;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
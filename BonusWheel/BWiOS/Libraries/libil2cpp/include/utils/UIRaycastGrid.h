@@ -0,0 +1,336 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/NonCopyable.h"
+#include <algorithm>
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Broad phase for UnityEngine.UI.GraphicRaycaster: a uniform grid over a canvas' screen
+/// rect holding the screen space bounds of its raycast target Graphics.
+///
+/// GraphicRaycaster.Raycast tests every Graphic on the canvas with
+/// RectangleContainsScreenPoint and then sorts the hits by depth. With the grid, a
+/// pointer only visits the entries registered in the one cell under it (plus the few
+/// that cover a large part of the canvas), so the cost is proportional to the local
+/// overlap rather than to the number of Graphics. Query returns the candidates whose
+/// bounds contain the point, deepest first, ready for the exact per-Graphic tests
+/// (rotation, Graphic.Raycast, alpha hit testing) that stay with the caller.
+///
+/// Entries are updated incrementally: Update only touches the grid when the set of
+/// cells an entry overlaps changes, so moving an icon within its cell is a store.
+/// Handles pack an entry index with a generation that Remove bumps, so a handle that was
+/// removed already, or whose slot has since been reused, is refused by Update, SetDepth
+/// and Remove instead of corrupting another entry or the free list. Rects and points with
+/// NaN coordinates are refused as well: they cannot be bucketed.
+    class UIRaycastGrid : public il2cpp::utils::NonCopyable
+    {
+    public:
+        static const uint32_t kInvalidHandle = 0xFFFFFFFF;
+        static const uint32_t kIndexBits = 20;
+        static const uint32_t kMaxEntries = (1 << kIndexBits) - 1;
+
+        struct Rect
+        {
+            float xMin, yMin, xMax, yMax;
+        };
+
+        /// bounds is the canvas' screen rect; entries outside it are clamped to the border
+        /// cells. Entries overlapping more than maxCellsPerEntry cells are kept in a short
+        /// list that every query checks instead of being copied into each cell.
+        UIRaycastGrid(const Rect& bounds, float cellSize = 64.0f, uint32_t maxCellsPerEntry = 64)
+            : m_MaxCellsPerEntry(maxCellsPerEntry), m_FirstFree(kInvalidHandle)
+        {
+            Resize(bounds, cellSize);
+        }
+
+        /// Changes the grid, e.g. when the screen resizes, and re-buckets every entry.
+        void Resize(const Rect& bounds, float cellSize)
+        {
+            m_Bounds = bounds;
+            m_CellSize = cellSize > 1.0f ? cellSize : 1.0f;
+            m_Columns = CellCount(bounds.xMax - bounds.xMin, m_CellSize);
+            m_Rows = CellCount(bounds.yMax - bounds.yMin, m_CellSize);
+
+            m_Cells.clear();
+            m_Cells.resize(m_Columns * m_Rows);
+            m_Large.clear();
+
+            for (uint32_t index = 0; index < m_Entries.size(); index++)
+            {
+                Entry& entry = m_Entries[index];
+                if (entry.userData == NULL)
+                    continue;
+                entry.cells = ComputeCells(entry.rect);
+                Link(index, entry.cells);
+            }
+        }
+
+        /// Returns kInvalidHandle if rect has a NaN coordinate or the grid is full.
+        uint32_t Insert(void* userData, const Rect& rect, int32_t depth)
+        {
+            IL2CPP_ASSERT(userData != NULL);
+            if (userData == NULL || !IsValidRect(rect))
+                return kInvalidHandle;
+
+            uint32_t index;
+            if (m_FirstFree != kInvalidHandle)
+            {
+                index = m_FirstFree;
+                m_FirstFree = m_Entries[index].nextFree;
+            }
+            else
+            {
+                if (m_Entries.size() >= kMaxEntries)
+                    return kInvalidHandle;
+                index = (uint32_t)m_Entries.size();
+                m_Entries.push_back(Entry());
+                m_Entries[index].generation = 0;
+            }
+
+            Entry& entry = m_Entries[index];
+            entry.userData = userData;
+            entry.rect = rect;
+            entry.depth = depth;
+            entry.cells = ComputeCells(rect);
+            entry.nextFree = kInvalidHandle;
+            Link(index, entry.cells);
+            return (entry.generation << kIndexBits) | index;
+        }
+
+        /// Returns false, leaving the entry alone, for stale handles and NaN rects.
+        bool Update(uint32_t handle, const Rect& rect)
+        {
+            Entry* entry = GetEntry(handle);
+            if (entry == NULL || !IsValidRect(rect))
+                return false;
+
+            entry->rect = rect;
+
+            CellRange cells = ComputeCells(rect);
+            if (cells == entry->cells)
+                return true;
+
+            uint32_t index = handle & kIndexMask;
+            Unlink(index, entry->cells);
+            entry->cells = cells;
+            Link(index, cells);
+            return true;
+        }
+
+        bool SetDepth(uint32_t handle, int32_t depth)
+        {
+            Entry* entry = GetEntry(handle);
+            if (entry == NULL)
+                return false;
+
+            entry->depth = depth;
+            return true;
+        }
+
+        /// Returns false for handles that were removed already.
+        bool Remove(uint32_t handle)
+        {
+            Entry* entry = GetEntry(handle);
+            if (entry == NULL)
+                return false;
+
+            uint32_t index = handle & kIndexMask;
+            Unlink(index, entry->cells);
+            entry->userData = NULL;
+            entry->generation = (entry->generation + 1) & kGenerationMask;
+            entry->nextFree = m_FirstFree;
+            m_FirstFree = index;
+            return true;
+        }
+
+        bool IsValid(uint32_t handle) const
+        {
+            return const_cast<UIRaycastGrid*>(this)->GetEntry(handle) != NULL;
+        }
+
+        /// Appends the userData of every entry whose rect contains (x, y), deepest first.
+        /// A NaN coordinate hits nothing.
+        void Query(float x, float y, std::vector<void*>& results)
+        {
+            m_Hits.clear();
+            if (x != x || y != y)
+                return;
+
+            // Points off the canvas clamp to the border cells, which is where any entry
+            // that can contain them was clamped to as well.
+            CollectHits(m_Cells[CellIndex(ColumnOf(x), RowOf(y))], x, y);
+            CollectHits(m_Large, x, y);
+
+            DepthDescending order = { &m_Entries };
+            std::stable_sort(m_Hits.begin(), m_Hits.end(), order);
+            for (size_t i = 0; i < m_Hits.size(); i++)
+                results.push_back(m_Entries[m_Hits[i]].userData);
+        }
+
+    private:
+        static const uint32_t kIndexMask = (1 << kIndexBits) - 1;
+        static const uint32_t kGenerationMask = (1 << (32 - kIndexBits)) - 1;
+
+        struct CellRange
+        {
+            int32_t columnMin, rowMin, columnMax, rowMax;
+            bool large;
+
+            bool operator==(const CellRange& other) const
+            {
+                return large == other.large && columnMin == other.columnMin && rowMin == other.rowMin
+                    && columnMax == other.columnMax && rowMax == other.rowMax;
+            }
+        };
+
+        struct Entry
+        {
+            void* userData;
+            Rect rect;
+            int32_t depth;
+            CellRange cells;
+            uint32_t nextFree;
+            uint32_t generation;
+        };
+
+        struct DepthDescending
+        {
+            const std::vector<Entry>* entries;
+
+            bool operator()(uint32_t left, uint32_t right) const
+            {
+                return (*entries)[left].depth > (*entries)[right].depth;
+            }
+        };
+
+        static bool IsValidRect(const Rect& rect)
+        {
+            return rect.xMin == rect.xMin && rect.yMin == rect.yMin && rect.xMax == rect.xMax && rect.yMax == rect.yMax;
+        }
+
+        // Clamped while still a float: converting a value outside int32_t's range (or NaN
+        // bounds) is undefined.
+        static int32_t CellCount(float extent, float cellSize)
+        {
+            float count = ceilf(extent / cellSize);
+            if (!(count >= 1.0f))
+                return 1;
+            return count < 16384.0f ? (int32_t)count : 16384;
+        }
+
+        static int32_t CellOf(float offset, float cellSize, int32_t cellCount)
+        {
+            float cell = floorf(offset / cellSize);
+            if (!(cell >= 0.0f))
+                return 0;
+            return cell < (float)cellCount ? (int32_t)cell : cellCount - 1;
+        }
+
+        Entry* GetEntry(uint32_t handle)
+        {
+            uint32_t index = handle & kIndexMask;
+            if (handle == kInvalidHandle || index >= m_Entries.size())
+                return NULL;
+
+            Entry& entry = m_Entries[index];
+            if (entry.userData == NULL || entry.generation != handle >> kIndexBits)
+                return NULL;
+            return &entry;
+        }
+
+        int32_t ColumnOf(float x) const
+        {
+            return CellOf(x - m_Bounds.xMin, m_CellSize, m_Columns);
+        }
+
+        int32_t RowOf(float y) const
+        {
+            return CellOf(y - m_Bounds.yMin, m_CellSize, m_Rows);
+        }
+
+        int32_t CellIndex(int32_t column, int32_t row) const
+        {
+            return row * m_Columns + column;
+        }
+
+        CellRange ComputeCells(const Rect& rect) const
+        {
+            CellRange range;
+            range.columnMin = ColumnOf(rect.xMin);
+            range.columnMax = ColumnOf(rect.xMax);
+            range.rowMin = RowOf(rect.yMin);
+            range.rowMax = RowOf(rect.yMax);
+
+            uint32_t cellCount = (uint32_t)(range.columnMax - range.columnMin + 1) * (uint32_t)(range.rowMax - range.rowMin + 1);
+            range.large = cellCount > m_MaxCellsPerEntry;
+            return range;
+        }
+
+        void Link(uint32_t handle, const CellRange& range)
+        {
+            if (range.large)
+            {
+                m_Large.push_back(handle);
+                return;
+            }
+
+            for (int32_t row = range.rowMin; row <= range.rowMax; row++)
+            {
+                for (int32_t column = range.columnMin; column <= range.columnMax; column++)
+                    m_Cells[CellIndex(column, row)].push_back(handle);
+            }
+        }
+
+        void Unlink(uint32_t handle, const CellRange& range)
+        {
+            if (range.large)
+            {
+                EraseHandle(m_Large, handle);
+                return;
+            }
+
+            for (int32_t row = range.rowMin; row <= range.rowMax; row++)
+            {
+                for (int32_t column = range.columnMin; column <= range.columnMax; column++)
+                    EraseHandle(m_Cells[CellIndex(column, row)], handle);
+            }
+        }
+
+        static void EraseHandle(std::vector<uint32_t>& handles, uint32_t handle)
+        {
+            std::vector<uint32_t>::iterator it = std::find(handles.begin(), handles.end(), handle);
+            IL2CPP_ASSERT(it != handles.end());
+            *it = handles.back();
+            handles.pop_back();
+        }
+
+        void CollectHits(const std::vector<uint32_t>& handles, float x, float y)
+        {
+            for (size_t i = 0; i < handles.size(); i++)
+            {
+                const Rect& rect = m_Entries[handles[i]].rect;
+                if (x >= rect.xMin && x <= rect.xMax && y >= rect.yMin && y <= rect.yMax)
+                    m_Hits.push_back(handles[i]);
+            }
+        }
+
+        Rect m_Bounds;
+        float m_CellSize;
+        int32_t m_Columns;
+        int32_t m_Rows;
+        uint32_t m_MaxCellsPerEntry;
+
+        std::vector<Entry> m_Entries;
+        uint32_t m_FirstFree;
+        std::vector<std::vector<uint32_t> > m_Cells;
+        std::vector<uint32_t> m_Large;
+        std::vector<uint32_t> m_Hits;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/NonCopyable.h"
+#include <algorithm>
+#include <stdint.h>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Allocation free replacement for the sort at the end of EventSystem.RaycastAll.
+///
+/// RaycastAll lets every raycaster append to one List<RaycastResult> and then sorts it
+/// with the RaycastComparer delegate, a full comparison sort that reads module
+/// properties through virtual calls on every comparison. Here each raycaster hands in
+/// its results as a run already ordered by the per-result part of that comparer
+/// (SortRun does it for raycasters that do not produce them in order), together with
+/// its module level key read once. Merge then combines the runs with a k-way merge into
+/// a buffer that is reused across calls, comparing plain fields.
+///
+/// The order is RaycastComparer's: camera depth, sortOrderPriority and
+/// renderOrderPriority between different modules (all descending), then sorting layer
+/// value, sortingOrder and depth (descending; depth only within the same root
+/// raycaster), then distance and index (ascending).
+    class UIRaycastMerger : public il2cpp::utils::NonCopyable
+    {
+    public:
+        struct ModuleKey
+        {
+            const void* module;
+            const void* rootRaycaster;
+            bool hasEventCamera;
+            float eventCameraDepth;
+            int32_t sortOrderPriority;
+            int32_t renderOrderPriority;
+        };
+
+        struct ResultKey
+        {
+            int32_t sortingLayerValue;  // SortingLayer.GetLayerValueFromID(sortingLayer)
+            int32_t sortingOrder;
+            int32_t depth;
+            float distance;
+            float index;
+            uint32_t payload;           // caller's reference to the RaycastResult
+        };
+
+        void Clear()
+        {
+            m_Runs.clear();
+            m_Keys.clear();
+        }
+
+        /// Sorts a raycaster's results into run order.
+        static void SortRun(ResultKey* results, size_t count)
+        {
+            std::sort(results, results + count, CompareWithinModule);
+        }
+
+        /// Adds one raycaster's results, which must already be in run order.
+        void AddRun(const ModuleKey& module, const ResultKey* results, size_t count)
+        {
+            if (count == 0)
+                return;
+
+            Run run = { module, m_Keys.size(), m_Keys.size() + count };
+            m_Runs.push_back(run);
+            m_Keys.insert(m_Keys.end(), results, results + count);
+        }
+
+        /// Payloads of every added result in RaycastComparer order. The returned buffer is
+        /// owned by the merger and reused by the next Merge.
+        const std::vector<uint32_t>& Merge()
+        {
+            m_Merged.clear();
+            m_Heap.clear();
+
+            for (size_t i = 0; i < m_Runs.size(); i++)
+                m_Heap.push_back(Cursor(i, m_Runs[i].begin));
+
+            HeapOrder order = { this };
+            std::make_heap(m_Heap.begin(), m_Heap.end(), order);
+
+            while (!m_Heap.empty())
+            {
+                std::pop_heap(m_Heap.begin(), m_Heap.end(), order);
+                Cursor& cursor = m_Heap.back();
+                m_Merged.push_back(m_Keys[cursor.second].payload);
+
+                if (++cursor.second != m_Runs[cursor.first].end)
+                    std::push_heap(m_Heap.begin(), m_Heap.end(), order);
+                else
+                    m_Heap.pop_back();
+            }
+
+            return m_Merged;
+        }
+
+    private:
+        struct Run
+        {
+            ModuleKey module;
+            size_t begin;
+            size_t end;
+        };
+
+        // (run index, key index)
+        typedef std::pair<size_t, size_t> Cursor;
+
+        static bool CompareWithinModule(const ResultKey& left, const ResultKey& right)
+        {
+            return CompareResults(left, right, true) < 0;
+        }
+
+        static int CompareResults(const ResultKey& left, const ResultKey& right, bool sameRoot)
+        {
+            if (left.sortingLayerValue != right.sortingLayerValue)
+                return left.sortingLayerValue > right.sortingLayerValue ? -1 : 1;
+            if (left.sortingOrder != right.sortingOrder)
+                return left.sortingOrder > right.sortingOrder ? -1 : 1;
+            if (left.depth != right.depth && sameRoot)
+                return left.depth > right.depth ? -1 : 1;
+            if (left.distance != right.distance)
+                return left.distance < right.distance ? -1 : 1;
+            if (left.index != right.index)
+                return left.index < right.index ? -1 : 1;
+            return 0;
+        }
+
+        static int CompareModules(const ModuleKey& left, const ModuleKey& right)
+        {
+            if (left.module == right.module)
+                return 0;
+            if (left.hasEventCamera && right.hasEventCamera && left.eventCameraDepth != right.eventCameraDepth)
+                return left.eventCameraDepth > right.eventCameraDepth ? -1 : 1;
+            if (left.sortOrderPriority != right.sortOrderPriority)
+                return left.sortOrderPriority > right.sortOrderPriority ? -1 : 1;
+            if (left.renderOrderPriority != right.renderOrderPriority)
+                return left.renderOrderPriority > right.renderOrderPriority ? -1 : 1;
+            return 0;
+        }
+
+        int Compare(const Cursor& left, const Cursor& right) const
+        {
+            const ModuleKey& leftModule = m_Runs[left.first].module;
+            const ModuleKey& rightModule = m_Runs[right.first].module;
+
+            int result = CompareModules(leftModule, rightModule);
+            if (result != 0)
+                return result;
+
+            result = CompareResults(m_Keys[left.second], m_Keys[right.second], leftModule.rootRaycaster == rightModule.rootRaycaster);
+            if (result != 0)
+                return result;
+
+            // Keep equal results in run order so the merge is deterministic.
+            return left.first < right.first ? -1 : (left.first > right.first ? 1 : 0);
+        }
+
+        // std heaps are max heaps, so the element that sorts first must compare greatest.
+        struct HeapOrder
+        {
+            const UIRaycastMerger* merger;
+
+            bool operator()(const Cursor& left, const Cursor& right) const
+            {
+                return merger->Compare(left, right) > 0;
+            }
+        };
+
+        std::vector<Run> m_Runs;
+        std::vector<ResultKey> m_Keys;
+        std::vector<Cursor> m_Heap;
+        std::vector<uint32_t> m_Merged;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
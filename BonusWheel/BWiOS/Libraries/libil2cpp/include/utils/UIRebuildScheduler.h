@@ -0,0 +1,306 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/HashUtils.h"
+#include "utils/NonCopyable.h"
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Layout and graphic rebuild queues for UnityEngine.UI.CanvasUpdateRegistry.
+///
+/// The registry keeps both queues in IndexedSets, walks the hierarchy (ParentCount) for
+/// every queued element each frame to sort the layout queue parents first, and runs
+/// CleanInvalidItems even when nothing was queued. Here each element's hierarchy depth
+/// is computed once through the callback and cached until InvalidateDepth (parent
+/// changes), and the layout queue is kept in per-depth buckets as elements register, so
+/// the parents-first order is read out without sorting. IsIdle lets PerformUpdate skip
+/// all of its work on frames where nothing was dirtied, such as frames that only move a
+/// Transform.
+///
+/// Semantics follow the registry: registering twice is a no-op that returns false,
+/// removal swaps with the last element, layout elements registered during the layout
+/// pass are appended to the pass, and graphic registration or any removal during a pass
+/// is refused.
+    class UIRebuildScheduler : public il2cpp::utils::NonCopyable
+    {
+    public:
+        typedef int32_t (*ComputeDepthCallback)(void* element, void* context);
+        typedef bool (*IsValidCallback)(void* element, void* context);
+
+        UIRebuildScheduler(ComputeDepthCallback computeDepth, void* context)
+            : m_ComputeDepth(computeDepth), m_Context(context), m_LayoutCount(0),
+            m_PerformingLayoutUpdate(false), m_PerformingGraphicUpdate(false)
+        {
+        }
+
+        bool IsIdle() const
+        {
+            return m_LayoutCount == 0 && m_GraphicQueue.empty();
+        }
+
+        bool RegisterForLayoutRebuild(void* element)
+        {
+            ElementState& state = GetState(element);
+            if (state.layoutIndex != kNotQueued)
+                return false;
+
+            if (m_PerformingLayoutUpdate)
+            {
+                // Picked up by the running pass, as the registry's index loop would.
+                state.layoutIndex = kQueuedDuringPass;
+                m_LayoutPass.push_back(element);
+                return true;
+            }
+
+            if (state.depth == kUnknownDepth)
+                state.depth = m_ComputeDepth(element, m_Context);
+            AddToBucket(element, state);
+            return true;
+        }
+
+        bool RegisterForGraphicRebuild(void* element)
+        {
+            if (m_PerformingGraphicUpdate)
+                return false;
+
+            ElementState& state = GetState(element);
+            if (state.graphicIndex != kNotQueued)
+                return false;
+
+            state.graphicIndex = (int32_t)m_GraphicQueue.size();
+            m_GraphicQueue.push_back(element);
+            return true;
+        }
+
+        bool UnregisterForLayoutRebuild(void* element)
+        {
+            if (m_PerformingLayoutUpdate)
+                return false;
+
+            StateMap::iterator it = m_States.find(element);
+            if (it == m_States.end() || it->second.layoutIndex == kNotQueued)
+                return false;
+
+            RemoveFromBucket(it->second);
+            return true;
+        }
+
+        bool UnregisterForGraphicRebuild(void* element)
+        {
+            if (m_PerformingGraphicUpdate)
+                return false;
+
+            StateMap::iterator it = m_States.find(element);
+            if (it == m_States.end() || it->second.graphicIndex == kNotQueued)
+                return false;
+
+            int32_t index = it->second.graphicIndex;
+            void* last = m_GraphicQueue.back();
+            m_GraphicQueue[index] = last;
+            m_GraphicQueue.pop_back();
+            m_States[last].graphicIndex = index;
+            it->second.graphicIndex = kNotQueued;
+            return true;
+        }
+
+        /// Call when the element's parent changes; a queued element moves to its new bucket.
+        void InvalidateDepth(void* element)
+        {
+            StateMap::iterator it = m_States.find(element);
+            if (it == m_States.end())
+                return;
+
+            ElementState& state = it->second;
+            if (state.layoutIndex >= 0)
+            {
+                RemoveFromBucket(state);
+                state.depth = m_ComputeDepth(element, m_Context);
+                AddToBucket(element, state);
+            }
+            else
+            {
+                state.depth = kUnknownDepth;
+            }
+        }
+
+        /// Drops everything known about a destroyed element. An element a running pass
+        /// still holds is dropped when the last pass holding it ends.
+        void Forget(void* element)
+        {
+            StateMap::iterator it = m_States.find(element);
+            if (it == m_States.end())
+                return;
+
+            UnregisterForLayoutRebuild(element);
+            UnregisterForGraphicRebuild(element);
+            if (it->second.layoutIndex == kNotQueued && it->second.graphicIndex == kNotQueued)
+            {
+                m_States.erase(it);
+            }
+            else if (!it->second.forgotten)
+            {
+                it->second.forgotten = true;
+                m_PendingForgets.push_back(element);
+            }
+        }
+
+        /// CleanInvalidItems: removes queued elements the callback rejects. Does nothing,
+        /// not even a walk, when both queues are empty.
+        void RemoveInvalid(IsValidCallback isValid, void* context)
+        {
+            if (IsIdle())
+                return;
+
+            for (size_t depth = 0; depth < m_Buckets.size(); depth++)
+            {
+                std::vector<void*>& bucket = m_Buckets[depth];
+                for (size_t i = bucket.size(); i-- > 0;)
+                {
+                    if (!isValid(bucket[i], context))
+                        RemoveFromBucket(m_States[bucket[i]]);
+                }
+            }
+
+            for (size_t i = m_GraphicQueue.size(); i-- > 0;)
+            {
+                if (!isValid(m_GraphicQueue[i], context))
+                    UnregisterForGraphicRebuild(m_GraphicQueue[i]);
+            }
+        }
+
+        /// Starts the layout pass and returns the queue parents first. The caller iterates
+        /// by index, as elements registered during the pass are appended to it.
+        const std::vector<void*>& BeginLayoutUpdate()
+        {
+            m_LayoutPass.clear();
+            for (size_t depth = 0; depth < m_Buckets.size(); depth++)
+                m_LayoutPass.insert(m_LayoutPass.end(), m_Buckets[depth].begin(), m_Buckets[depth].end());
+
+            m_PerformingLayoutUpdate = true;
+            return m_LayoutPass;
+        }
+
+        void EndLayoutUpdate()
+        {
+            for (size_t i = 0; i < m_LayoutPass.size(); i++)
+                m_States[m_LayoutPass[i]].layoutIndex = kNotQueued;
+            for (size_t depth = 0; depth < m_Buckets.size(); depth++)
+                m_Buckets[depth].clear();
+
+            m_LayoutCount = 0;
+            m_LayoutPass.clear();
+            m_PerformingLayoutUpdate = false;
+            ErasePendingForgets();
+        }
+
+        /// Starts the graphic pass; the queue is in registration order.
+        const std::vector<void*>& BeginGraphicUpdate()
+        {
+            m_PerformingGraphicUpdate = true;
+            return m_GraphicQueue;
+        }
+
+        void EndGraphicUpdate()
+        {
+            for (size_t i = 0; i < m_GraphicQueue.size(); i++)
+                m_States[m_GraphicQueue[i]].graphicIndex = kNotQueued;
+
+            m_GraphicQueue.clear();
+            m_PerformingGraphicUpdate = false;
+            ErasePendingForgets();
+        }
+
+    private:
+        static const int32_t kNotQueued = -1;
+        static const int32_t kQueuedDuringPass = -2;
+        static const int32_t kUnknownDepth = -1;
+
+        struct ElementState
+        {
+            int32_t depth;
+            int32_t layoutIndex;    // index in m_Buckets[depth]
+            int32_t graphicIndex;   // index in m_GraphicQueue
+            bool forgotten;         // destroyed while a pass held it, see m_PendingForgets
+
+            ElementState() : depth(kUnknownDepth), layoutIndex(kNotQueued), graphicIndex(kNotQueued), forgotten(false) {}
+        };
+
+        typedef std::unordered_map<void*, ElementState, il2cpp::utils::PassThroughHash<void*> > StateMap;
+
+        ElementState& GetState(void* element)
+        {
+            ElementState& state = m_States[element];
+            if (state.forgotten)
+            {
+                // A new element at the address of one destroyed during the pass: it keeps
+                // the entry, but not the old element's depth.
+                state.forgotten = false;
+                if (state.layoutIndex < 0)
+                    state.depth = kUnknownDepth;
+            }
+            return state;
+        }
+
+        // Erases the entries of elements forgotten during a pass once no pass holds them.
+        void ErasePendingForgets()
+        {
+            size_t kept = 0;
+            for (size_t i = 0; i < m_PendingForgets.size(); i++)
+            {
+                StateMap::iterator it = m_States.find(m_PendingForgets[i]);
+                if (it == m_States.end() || !it->second.forgotten)
+                    continue;
+
+                if (it->second.layoutIndex == kNotQueued && it->second.graphicIndex == kNotQueued)
+                    m_States.erase(it);
+                else
+                    m_PendingForgets[kept++] = m_PendingForgets[i];
+            }
+            m_PendingForgets.resize(kept);
+        }
+
+        void AddToBucket(void* element, ElementState& state)
+        {
+            int32_t depth = state.depth < 0 ? 0 : state.depth;
+            if ((size_t)depth >= m_Buckets.size())
+                m_Buckets.resize(depth + 1);
+
+            state.layoutIndex = (int32_t)m_Buckets[depth].size();
+            m_Buckets[depth].push_back(element);
+            m_LayoutCount++;
+        }
+
+        void RemoveFromBucket(ElementState& state)
+        {
+            std::vector<void*>& bucket = m_Buckets[state.depth < 0 ? 0 : state.depth];
+            int32_t index = state.layoutIndex;
+
+            void* last = bucket.back();
+            bucket[index] = last;
+            bucket.pop_back();
+            m_States[last].layoutIndex = index;
+
+            state.layoutIndex = kNotQueued;
+            m_LayoutCount--;
+        }
+
+        ComputeDepthCallback m_ComputeDepth;
+        void* m_Context;
+
+        StateMap m_States;
+        std::vector<std::vector<void*> > m_Buckets;
+        size_t m_LayoutCount;
+        std::vector<void*> m_LayoutPass;
+        std::vector<void*> m_GraphicQueue;
+        std::vector<void*> m_PendingForgets;
+
+        bool m_PerformingLayoutUpdate;
+        bool m_PerformingGraphicUpdate;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
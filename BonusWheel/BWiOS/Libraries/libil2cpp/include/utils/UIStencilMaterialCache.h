@@ -0,0 +1,188 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/HashUtils.h"
+#include "utils/NonCopyable.h"
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Reference counted cache of the stencil materials behind UnityEngine.UI.StencilMaterial.
+///
+/// StencilMaterial.Add and Remove scan a static List<MatEntry> for the entry matching the
+/// base material and the stencil state (or the custom material being released), so every
+/// masked Graphic pays a linear search on each material rebuild, and nested masks make
+/// the list long. Here both lookups are hashed. Add returns the cached variant and bumps
+/// its count, or creates it through the callback on a miss; Remove drops a reference and
+/// destroys the variant through the callback when the last one goes.
+    class UIStencilMaterialCache : public il2cpp::utils::NonCopyable
+    {
+    public:
+        static const int32_t kColorWriteMaskAll = 15;
+
+        struct Key
+        {
+            void* baseMaterial;
+            int32_t stencilId;
+            int32_t operation;
+            int32_t compareFunction;
+            int32_t readMask;
+            int32_t writeMask;
+            int32_t colorWriteMask;
+
+            bool operator==(const Key& other) const
+            {
+                return baseMaterial == other.baseMaterial && stencilId == other.stencilId && operation == other.operation
+                    && compareFunction == other.compareFunction && readMask == other.readMask && writeMask == other.writeMask
+                    && colorWriteMask == other.colorWriteMask;
+            }
+        };
+
+        typedef void* (*CreateMaterialFunc)(const Key& key, void* context);
+        typedef void (*DestroyMaterialFunc)(void* material, void* context);
+
+        UIStencilMaterialCache(CreateMaterialFunc createMaterial, DestroyMaterialFunc destroyMaterial, void* context)
+            : m_CreateMaterial(createMaterial), m_DestroyMaterial(destroyMaterial), m_Context(context), m_HitCount(0), m_MissCount(0)
+        {
+        }
+
+        ~UIStencilMaterialCache()
+        {
+            Clear();
+        }
+
+        /// StencilMaterial.Add. Like the original, a missing base material or a state that
+        /// neither uses the stencil nor masks colors returns the base material uncounted.
+        void* Add(const Key& key)
+        {
+            if (key.baseMaterial == NULL || (key.stencilId <= 0 && key.colorWriteMask == kColorWriteMaskAll))
+                return key.baseMaterial;
+
+            KeyMap::iterator it = m_ByKey.find(key);
+            if (it != m_ByKey.end())
+            {
+                m_HitCount++;
+                Entry& entry = m_Entries[it->second];
+                entry.referenceCount++;
+                return entry.material;
+            }
+
+            m_MissCount++;
+            void* material = m_CreateMaterial(key, m_Context);
+            if (material == NULL)
+                return key.baseMaterial;
+
+            uint32_t index = AllocateEntry();
+            Entry& entry = m_Entries[index];
+            entry.key = key;
+            entry.material = material;
+            entry.referenceCount = 1;
+
+            m_ByKey.insert(std::make_pair(key, index));
+            m_ByMaterial.insert(std::make_pair(material, index));
+            return material;
+        }
+
+        /// StencilMaterial.Remove. Materials the cache did not hand out are ignored.
+        void Remove(void* material)
+        {
+            MaterialMap::iterator it = m_ByMaterial.find(material);
+            if (it == m_ByMaterial.end())
+                return;
+
+            uint32_t index = it->second;
+            Entry& entry = m_Entries[index];
+            if (--entry.referenceCount > 0)
+                return;
+
+            m_ByMaterial.erase(it);
+            m_ByKey.erase(entry.key);
+            m_DestroyMaterial(entry.material, m_Context);
+
+            entry.material = NULL;
+            m_FreeEntries.push_back(index);
+        }
+
+        /// StencilMaterial.ClearAll: destroys every cached variant regardless of its count.
+        /// The cache is emptied before the first callback runs, so the callback may use it.
+        void Clear()
+        {
+            std::vector<Entry> entries;
+            entries.swap(m_Entries);
+            m_FreeEntries.clear();
+            m_ByKey.clear();
+            m_ByMaterial.clear();
+
+            for (size_t i = 0; i < entries.size(); i++)
+            {
+                if (entries[i].material != NULL)
+                    m_DestroyMaterial(entries[i].material, m_Context);
+            }
+        }
+
+        uint32_t GetReferenceCount(void* material) const
+        {
+            MaterialMap::const_iterator it = m_ByMaterial.find(material);
+            return it == m_ByMaterial.end() ? 0 : m_Entries[it->second].referenceCount;
+        }
+
+        size_t GetMaterialCount() const { return m_ByMaterial.size(); }
+        uint64_t GetHitCount() const { return m_HitCount; }
+        uint64_t GetMissCount() const { return m_MissCount; }
+
+    private:
+        struct Entry
+        {
+            Key key;
+            void* material;
+            uint32_t referenceCount;
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const
+            {
+                size_t hash = HashUtils::AlignedPointerHash(key.baseMaterial);
+                hash = HashUtils::Combine(hash, (size_t)key.stencilId);
+                hash = HashUtils::Combine(hash, (size_t)key.operation);
+                hash = HashUtils::Combine(hash, (size_t)key.compareFunction);
+                hash = HashUtils::Combine(hash, (size_t)key.readMask);
+                hash = HashUtils::Combine(hash, (size_t)key.writeMask);
+                return HashUtils::Combine(hash, (size_t)key.colorWriteMask);
+            }
+        };
+
+        typedef std::unordered_map<Key, uint32_t, KeyHash> KeyMap;
+        typedef std::unordered_map<void*, uint32_t, il2cpp::utils::PassThroughHash<void*> > MaterialMap;
+
+        uint32_t AllocateEntry()
+        {
+            if (!m_FreeEntries.empty())
+            {
+                uint32_t index = m_FreeEntries.back();
+                m_FreeEntries.pop_back();
+                return index;
+            }
+
+            m_Entries.push_back(Entry());
+            return (uint32_t)m_Entries.size() - 1;
+        }
+
+        CreateMaterialFunc m_CreateMaterial;
+        DestroyMaterialFunc m_DestroyMaterial;
+        void* m_Context;
+
+        std::vector<Entry> m_Entries;
+        std::vector<uint32_t> m_FreeEntries;
+        KeyMap m_ByKey;
+        MaterialMap m_ByMaterial;
+
+        uint64_t m_HitCount;
+        uint64_t m_MissCount;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
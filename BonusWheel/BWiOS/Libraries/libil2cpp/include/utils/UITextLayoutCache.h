@@ -0,0 +1,313 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "il2cpp-string-types.h"
+#include "utils/HashUtils.h"
+#include "utils/NonCopyable.h"
+#include "utils/StringUtils.h"
+#include "utils/UIVertex.h"
+#include <string.h>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Least recently used cache of glyph quads for Text.OnPopulateMesh.
+///
+/// Text runs TextGenerator.PopulateWithErrors whenever it is marked dirty, which
+/// includes a label flipping back to a string it showed a moment ago and every tracked
+/// Text after a font atlas rebuild. With the cache, OnPopulateMesh looks up the
+/// generated vertices by text and generation settings first and only lays the string out
+/// on a miss; a hit is a copy of the stored quads.
+///
+/// Entries are evicted least recently used first once either the entry or the vertex
+/// budget is exceeded. Font atlas rebuilds change the UVs of every glyph of that font,
+/// so FontUpdateTracker should call InvalidateFont before rebuilding its Texts.
+    class UITextLayoutCache : public il2cpp::utils::NonCopyable
+    {
+    public:
+        /// Everything besides the string that shapes the generated vertices: the fields of
+        /// TextGenerationSettings, with enums as their integer values and generationExtents
+        /// as width and height. Every field is part of the key, so two settings that lay
+        /// out differently can never share an entry.
+        struct Settings
+        {
+            const void* font;
+            UIColor32 color;
+            int32_t fontSize;
+            int32_t fontStyle;
+            int32_t alignment;          // TextAnchor
+            int32_t horizontalOverflow;
+            int32_t verticalOverflow;
+            int32_t resizeTextMinSize;
+            int32_t resizeTextMaxSize;
+            float lineSpacing;
+            float scaleFactor;
+            float width;
+            float height;
+            UIVector2 pivot;
+            bool richText;
+            bool resizeTextForBestFit;
+            bool alignByGeometry;
+            bool updateBounds;
+            bool generateOutOfBounds;
+        };
+
+        UITextLayoutCache(uint32_t maxEntries = 64, size_t maxVertices = 64 * 1024)
+            : m_MaxEntries(maxEntries > 0 ? maxEntries : 1), m_MaxVertices(maxVertices), m_VertexCount(0), m_LiveCount(0),
+            m_Head(kNone), m_Tail(kNone), m_FirstFree(kNone), m_HitCount(0), m_MissCount(0)
+        {
+            m_Buckets.resize(RoundUpToPowerOfTwo(m_MaxEntries * 2), (uint32_t)kNone);
+        }
+
+        /// Returns the cached vertices for the string, or NULL on a miss. The pointer stays
+        /// valid until the next Store, InvalidateFont or Clear.
+        const UIVertex* Find(const Il2CppChar* text, size_t length, const Settings& settings, size_t* vertexCount)
+        {
+            size_t hash = ComputeHash(text, length, settings);
+            for (uint32_t index = m_Buckets[hash & (m_Buckets.size() - 1)]; index != kNone; index = m_Entries[index].nextInBucket)
+            {
+                Entry& entry = m_Entries[index];
+                if (entry.hash != hash || !Matches(entry, text, length, settings))
+                    continue;
+
+                MoveToFront(index);
+                m_HitCount++;
+                *vertexCount = entry.vertices.size();
+                return entry.vertices.empty() ? EmptyLayout() : &entry.vertices[0];
+            }
+
+            m_MissCount++;
+            *vertexCount = 0;
+            return NULL;
+        }
+
+        /// Stores freshly generated vertices, replacing an older entry for the same key.
+        void Store(const Il2CppChar* text, size_t length, const Settings& settings, const UIVertex* vertices, size_t vertexCount)
+        {
+            if (vertexCount > m_MaxVertices)
+                return;
+
+            size_t hash = ComputeHash(text, length, settings);
+            uint32_t existing = FindIndex(hash, text, length, settings);
+            if (existing != kNone)
+                Evict(existing);
+
+            while (m_Head != kNone && (m_LiveCount >= m_MaxEntries || m_VertexCount + vertexCount > m_MaxVertices))
+                Evict(m_Tail);
+
+            uint32_t index = AllocateEntry();
+            Entry& entry = m_Entries[index];
+            entry.text.assign(text, length);
+            entry.settings = settings;
+            entry.hash = hash;
+            entry.vertices.assign(vertices, vertices + vertexCount);
+            m_VertexCount += vertexCount;
+
+            uint32_t& bucket = m_Buckets[hash & (m_Buckets.size() - 1)];
+            entry.nextInBucket = bucket;
+            bucket = index;
+            LinkFront(index);
+        }
+
+        /// Drops every entry laid out with the font.
+        void InvalidateFont(const void* font)
+        {
+            for (uint32_t index = m_Head; index != kNone;)
+            {
+                uint32_t next = m_Entries[index].next;
+                if (m_Entries[index].settings.font == font)
+                    Evict(index);
+                index = next;
+            }
+        }
+
+        void Clear()
+        {
+            while (m_Head != kNone)
+                Evict(m_Head);
+        }
+
+        uint64_t GetHitCount() const { return m_HitCount; }
+        uint64_t GetMissCount() const { return m_MissCount; }
+        uint32_t GetEntryCount() const { return m_LiveCount; }
+        size_t GetVertexCount() const { return m_VertexCount; }
+
+    private:
+        static const uint32_t kNone = 0xFFFFFFFF;
+
+        struct Entry
+        {
+            UTF16String text;
+            Settings settings;
+            size_t hash;
+            std::vector<UIVertex> vertices;
+            uint32_t prev;
+            uint32_t next;          // LRU order, or the free list
+            uint32_t nextInBucket;
+        };
+
+        // Returned for entries that cached an empty layout, so such a hit is not taken for a miss.
+        static const UIVertex* EmptyLayout()
+        {
+            static const UIVertex empty = UIVertex();
+            return &empty;
+        }
+
+        static size_t RoundUpToPowerOfTwo(size_t value)
+        {
+            size_t result = 1;
+            while (result < value)
+                result <<= 1;
+            return result;
+        }
+
+        // 0 and -0 compare equal in Matches, so they have to hash the same.
+        static size_t HashFloat(float value)
+        {
+            uint32_t bits = 0;
+            if (value != 0.0f)
+                memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        static size_t ComputeHash(const Il2CppChar* text, size_t length, const Settings& settings)
+        {
+            uint32_t colorBits;
+            memcpy(&colorBits, &settings.color, sizeof(colorBits));
+            uint32_t flags = (settings.richText ? 1 : 0) | (settings.resizeTextForBestFit ? 2 : 0) | (settings.alignByGeometry ? 4 : 0)
+                | (settings.updateBounds ? 8 : 0) | (settings.generateOutOfBounds ? 16 : 0);
+
+            size_t hash = StringUtils::Hash(text, length);
+            hash = HashUtils::Combine(hash, HashUtils::AlignedPointerHash(const_cast<void*>(settings.font)));
+            hash = HashUtils::Combine(hash, colorBits);
+            hash = HashUtils::Combine(hash, (size_t)settings.fontSize);
+            hash = HashUtils::Combine(hash, (size_t)settings.fontStyle);
+            hash = HashUtils::Combine(hash, (size_t)settings.alignment);
+            hash = HashUtils::Combine(hash, (size_t)settings.horizontalOverflow);
+            hash = HashUtils::Combine(hash, (size_t)settings.verticalOverflow);
+            hash = HashUtils::Combine(hash, (size_t)settings.resizeTextMinSize);
+            hash = HashUtils::Combine(hash, (size_t)settings.resizeTextMaxSize);
+            hash = HashUtils::Combine(hash, HashFloat(settings.lineSpacing));
+            hash = HashUtils::Combine(hash, HashFloat(settings.scaleFactor));
+            hash = HashUtils::Combine(hash, HashFloat(settings.width));
+            hash = HashUtils::Combine(hash, HashFloat(settings.height));
+            hash = HashUtils::Combine(hash, HashFloat(settings.pivot.x));
+            hash = HashUtils::Combine(hash, HashFloat(settings.pivot.y));
+            return HashUtils::Combine(hash, flags);
+        }
+
+        static bool SameSettings(const Settings& left, const Settings& right)
+        {
+            return left.font == right.font && memcmp(&left.color, &right.color, sizeof(UIColor32)) == 0
+                && left.fontSize == right.fontSize && left.fontStyle == right.fontStyle && left.alignment == right.alignment
+                && left.horizontalOverflow == right.horizontalOverflow && left.verticalOverflow == right.verticalOverflow
+                && left.resizeTextMinSize == right.resizeTextMinSize && left.resizeTextMaxSize == right.resizeTextMaxSize
+                && left.lineSpacing == right.lineSpacing && left.scaleFactor == right.scaleFactor
+                && left.width == right.width && left.height == right.height
+                && left.pivot.x == right.pivot.x && left.pivot.y == right.pivot.y
+                && left.richText == right.richText && left.resizeTextForBestFit == right.resizeTextForBestFit
+                && left.alignByGeometry == right.alignByGeometry && left.updateBounds == right.updateBounds
+                && left.generateOutOfBounds == right.generateOutOfBounds;
+        }
+
+        static bool Matches(const Entry& entry, const Il2CppChar* text, size_t length, const Settings& settings)
+        {
+            return SameSettings(entry.settings, settings)
+                && entry.text.length() == length && memcmp(entry.text.data(), text, length * sizeof(Il2CppChar)) == 0;
+        }
+
+        uint32_t FindIndex(size_t hash, const Il2CppChar* text, size_t length, const Settings& settings) const
+        {
+            for (uint32_t index = m_Buckets[hash & (m_Buckets.size() - 1)]; index != kNone; index = m_Entries[index].nextInBucket)
+            {
+                if (m_Entries[index].hash == hash && Matches(m_Entries[index], text, length, settings))
+                    return index;
+            }
+            return kNone;
+        }
+
+        uint32_t AllocateEntry()
+        {
+            m_LiveCount++;
+            if (m_FirstFree != kNone)
+            {
+                uint32_t index = m_FirstFree;
+                m_FirstFree = m_Entries[index].next;
+                return index;
+            }
+
+            m_Entries.push_back(Entry());
+            return (uint32_t)m_Entries.size() - 1;
+        }
+
+        void Evict(uint32_t index)
+        {
+            Entry& entry = m_Entries[index];
+
+            uint32_t* link = &m_Buckets[entry.hash & (m_Buckets.size() - 1)];
+            while (*link != index)
+                link = &m_Entries[*link].nextInBucket;
+            *link = entry.nextInBucket;
+
+            Unlink(index);
+            m_VertexCount -= entry.vertices.size();
+            m_LiveCount--;
+
+            // Keep the capacity of both buffers for the next entry that reuses the slot.
+            entry.text.clear();
+            entry.vertices.clear();
+            entry.next = m_FirstFree;
+            m_FirstFree = index;
+        }
+
+        void LinkFront(uint32_t index)
+        {
+            Entry& entry = m_Entries[index];
+            entry.prev = kNone;
+            entry.next = m_Head;
+            if (m_Head != kNone)
+                m_Entries[m_Head].prev = index;
+            else
+                m_Tail = index;
+            m_Head = index;
+        }
+
+        void Unlink(uint32_t index)
+        {
+            Entry& entry = m_Entries[index];
+            if (entry.prev != kNone)
+                m_Entries[entry.prev].next = entry.next;
+            else
+                m_Head = entry.next;
+            if (entry.next != kNone)
+                m_Entries[entry.next].prev = entry.prev;
+            else
+                m_Tail = entry.prev;
+        }
+
+        void MoveToFront(uint32_t index)
+        {
+            if (m_Head == index)
+                return;
+            Unlink(index);
+            LinkFront(index);
+        }
+
+        uint32_t m_MaxEntries;
+        size_t m_MaxVertices;
+        size_t m_VertexCount;
+        uint32_t m_LiveCount;
+
+        std::vector<Entry> m_Entries;
+        std::vector<uint32_t> m_Buckets;
+        uint32_t m_Head;
+        uint32_t m_Tail;
+        uint32_t m_FirstFree;
+
+        uint64_t m_HitCount;
+        uint64_t m_MissCount;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
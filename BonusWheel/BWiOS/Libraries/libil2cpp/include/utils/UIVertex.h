@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace il2cpp
+{
+namespace utils
+{
+    // Plain layout twins of the UnityEngine value types the UI mesh code works on, so that
+    // native helpers can read and write generated UIVertex_t / Vector*_t / Color32_t data
+    // in place without pulling in generated headers.
+
+    struct UIVector2
+    {
+        float x, y;
+    };
+
+    struct UIVector3
+    {
+        float x, y, z;
+    };
+
+    struct UIVector4
+    {
+        float x, y, z, w;
+    };
+
+    struct UIColor32
+    {
+        uint8_t r, g, b, a;
+    };
+
+    // UnityEngine.UIVertex
+    struct UIVertex
+    {
+        UIVector3 position;
+        UIVector3 normal;
+        UIVector4 tangent;
+        UIColor32 color;
+        UIVector2 uv0;
+        UIVector2 uv1;
+        UIVector2 uv2;
+        UIVector2 uv3;
+    };
+
+    static const UIVector3 kUIDefaultNormal = { 0.0f, 0.0f, -1.0f };
+    static const UIVector4 kUIDefaultTangent = { 1.0f, 0.0f, 0.0f, -1.0f };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,381 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "utils/dynamic_array.h"
+#include "utils/NonCopyable.h"
+#include "utils/UIVertex.h"
+#include <math.h>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Structure of arrays replacement for the storage behind UnityEngine.UI.VertexHelper.
+///
+/// VertexHelper keeps one pooled List<T> per channel and appends one element per channel
+/// per vertex through List_1_Add, so a sliced Image costs 36 vertices x 8 generic calls.
+/// This buffer keeps the same channels in contiguous native arrays and grows all of them
+/// once per emitted block: the quad, rect, nine-slice, tiled, strip and glyph emitters
+/// below size the arrays for the whole block and then write it in a straight loop.
+///
+/// GetMeshData hands out the channel pointers directly, which is the layout Mesh vertex
+/// attribute uploads take, so filling a mesh needs no intermediate List copies. Indices
+/// follow VertexHelper's conventions (clockwise quads 0-1-2, 2-3-0) so output is
+/// interchangeable with it.
+    class UIVertexBuffer : public il2cpp::utils::NonCopyable
+    {
+    public:
+        /// VertexHelper.FillMesh refuses meshes with this many vertices or more.
+        static const size_t kMaxVertexCount = 65000;
+
+        struct MeshData
+        {
+            size_t vertexCount;
+            size_t indexCount;
+            const UIVector3* positions;
+            const UIColor32* colors;
+            const UIVector2* uv0;
+            const UIVector2* uv1;
+            const UIVector2* uv2;
+            const UIVector2* uv3;
+            const UIVector3* normals;
+            const UIVector4* tangents;
+            const int32_t* indices;
+        };
+
+        size_t GetVertexCount() const { return m_Positions.size(); }
+        size_t GetIndexCount() const { return m_Indices.size(); }
+        bool CanFillMesh() const { return GetVertexCount() < kMaxVertexCount; }
+
+        /// Empties the buffer but keeps its capacity, like VertexHelper.Clear.
+        void Clear()
+        {
+            m_Positions.resize_uninitialized(0);
+            m_Colors.resize_uninitialized(0);
+            m_Uv0.resize_uninitialized(0);
+            m_Uv1.resize_uninitialized(0);
+            m_Uv2.resize_uninitialized(0);
+            m_Uv3.resize_uninitialized(0);
+            m_Normals.resize_uninitialized(0);
+            m_Tangents.resize_uninitialized(0);
+            m_Indices.resize_uninitialized(0);
+        }
+
+        /// Appends count vertices with default normal, tangent and uv1-uv3, and returns the
+        /// index of the first one; callers fill positions, colors and uv0 through the
+        /// mutable accessors.
+        int32_t AddVertices(size_t count)
+        {
+            size_t first = m_Positions.size();
+            size_t size = first + count;
+
+            m_Positions.resize_uninitialized(size, true);
+            m_Colors.resize_uninitialized(size, true);
+            m_Uv0.resize_uninitialized(size, true);
+            m_Uv1.resize_initialized(size, UIVector2(), true);
+            m_Uv2.resize_initialized(size, UIVector2(), true);
+            m_Uv3.resize_initialized(size, UIVector2(), true);
+            m_Normals.resize_initialized(size, kUIDefaultNormal, true);
+            m_Tangents.resize_initialized(size, kUIDefaultTangent, true);
+
+            return (int32_t)first;
+        }
+
+        /// Appends count indices and returns a pointer to the first.
+        int32_t* AddIndices(size_t count)
+        {
+            size_t first = m_Indices.size();
+            m_Indices.resize_uninitialized(first + count, true);
+            return &m_Indices[first];
+        }
+
+        void AddVert(const UIVertex& vertex)
+        {
+            int32_t index = AddVertices(1);
+            SetVertex(index, vertex);
+        }
+
+        void AddTriangle(int32_t index0, int32_t index1, int32_t index2)
+        {
+            int32_t* indices = AddIndices(3);
+            indices[0] = index0;
+            indices[1] = index1;
+            indices[2] = index2;
+        }
+
+        /// VertexHelper.AddUIVertexQuad: four vertices, two triangles.
+        void AddQuad(const UIVertex* vertices)
+        {
+            int32_t first = AddVertices(4);
+            for (int32_t i = 0; i < 4; i++)
+                SetVertex(first + i, vertices[i]);
+            AddQuadIndices(first);
+        }
+
+        /// Image.AddQuad: an axis aligned rect from min to max, textured from uvMin to uvMax.
+        void AddRect(UIVector2 min, UIVector2 max, UIColor32 color, UIVector2 uvMin, UIVector2 uvMax)
+        {
+            int32_t first = AddVertices(4);
+            WriteRect(first, min, max, color, uvMin, uvMax);
+            AddQuadIndices(first);
+        }
+
+        /// Image.GenerateSlicedSprite: the nine cells of the grid spanned by x[0..3] and
+        /// y[0..3], with matching texture coordinates, in one block. The center cell is
+        /// skipped unless fillCenter is set.
+        void AddSlicedGrid(const float x[4], const float y[4], const float u[4], const float v[4], UIColor32 color, bool fillCenter)
+        {
+            int32_t quadCount = fillCenter ? 9 : 8;
+            int32_t first = AddVertices(quadCount * 4);
+            int32_t* indices = AddIndices(quadCount * 6);
+
+            int32_t vertex = first;
+            for (int32_t column = 0; column < 3; column++)
+            {
+                for (int32_t row = 0; row < 3; row++)
+                {
+                    if (!fillCenter && column == 1 && row == 1)
+                        continue;
+
+                    UIVector2 min = { x[column], y[row] };
+                    UIVector2 max = { x[column + 1], y[row + 1] };
+                    UIVector2 uvMin = { u[column], v[row] };
+                    UIVector2 uvMax = { u[column + 1], v[row + 1] };
+                    WriteRect(vertex, min, max, color, uvMin, uvMax);
+                    WriteQuadIndices(indices, vertex);
+
+                    vertex += 4;
+                    indices += 6;
+                }
+            }
+        }
+
+        /// Image.GenerateTiledSprite's inner area: repeats the uvMin..uvMax tile of size
+        /// tileSize over min..max, cropping the last row and column of tiles (and their
+        /// texture coordinates) at max. Returns false, emitting nothing, if that would take
+        /// the buffer past kMaxVertexCount, in which case Image falls back to stretching.
+        bool AddTiledRect(UIVector2 min, UIVector2 max, UIVector2 tileSize, UIColor32 color, UIVector2 uvMin, UIVector2 uvMax)
+        {
+            if (tileSize.x <= 0.0f || tileSize.y <= 0.0f || max.x <= min.x || max.y <= min.y)
+                return true;
+
+            double columns = ceil(((double)max.x - min.x) / tileSize.x);
+            double rows = ceil(((double)max.y - min.y) / tileSize.y);
+            if (columns * rows * 4 + GetVertexCount() >= kMaxVertexCount)
+                return false;
+
+            int32_t columnCount = (int32_t)columns;
+            int32_t rowCount = (int32_t)rows;
+            int32_t first = AddVertices(columnCount * rowCount * 4);
+            int32_t* indices = AddIndices(columnCount * rowCount * 6);
+
+            // Tile edges are computed from their index rather than accumulated, so every tile
+            // ends where the next one starts and the counts above are the counts emitted. The
+            // last row and column end at max even if the float edge lands a rounding error
+            // short of it, and a last tile whose start rounds up to max is skipped and its
+            // slots trimmed.
+            int32_t vertex = first;
+            for (int32_t row = 0; row < rowCount; row++)
+            {
+                float y1 = min.y + tileSize.y * row;
+                if (y1 >= max.y)
+                    break;
+
+                float y2 = min.y + tileSize.y * (row + 1);
+                UIVector2 clippedUvMax = uvMax;
+                if (y2 > max.y || row == rowCount - 1)
+                {
+                    clippedUvMax.y = uvMin.y + (uvMax.y - uvMin.y) * (max.y - y1) / tileSize.y;
+                    y2 = max.y;
+                }
+
+                for (int32_t column = 0; column < columnCount; column++)
+                {
+                    float x1 = min.x + tileSize.x * column;
+                    if (x1 >= max.x)
+                        break;
+
+                    float x2 = min.x + tileSize.x * (column + 1);
+                    clippedUvMax.x = uvMax.x;
+                    if (x2 > max.x || column == columnCount - 1)
+                    {
+                        clippedUvMax.x = uvMin.x + (uvMax.x - uvMin.x) * (max.x - x1) / tileSize.x;
+                        x2 = max.x;
+                    }
+
+                    UIVector2 tileMin = { x1, y1 };
+                    UIVector2 tileMax = { x2, y2 };
+                    WriteRect(vertex, tileMin, tileMax, color, uvMin, clippedUvMax);
+                    WriteQuadIndices(indices, vertex);
+
+                    vertex += 4;
+                    indices += 6;
+                }
+            }
+
+            TrimTo(vertex, indices);
+            return true;
+        }
+
+        /// A triangle strip of count vertices, emitted as an indexed triangle list with
+        /// alternating winding so every triangle faces the same way.
+        void AddStrip(const UIVector3* positions, const UIVector2* uvs, size_t count, UIColor32 color)
+        {
+            if (count < 3)
+                return;
+
+            int32_t first = AddVertices(count);
+            for (size_t i = 0; i < count; i++)
+            {
+                m_Positions[first + i] = positions[i];
+                m_Colors[first + i] = color;
+                m_Uv0[first + i] = uvs[i];
+            }
+
+            int32_t* indices = AddIndices((count - 2) * 3);
+            for (int32_t i = 0; i < (int32_t)count - 2; i++)
+            {
+                int32_t a = first + i;
+                indices[0] = a;
+                indices[1] = (i & 1) ? a + 2 : a + 1;
+                indices[2] = (i & 1) ? a + 1 : a + 2;
+                indices += 3;
+            }
+        }
+
+        /// Text.OnPopulateMesh: glyph quads from TextGenerator.verts, four vertices each,
+        /// scaled by unitsPerPixel and shifted by the pixel rounding offset.
+        void AddGlyphQuads(const UIVertex* vertices, size_t quadCount, float unitsPerPixel, UIVector2 offset)
+        {
+            int32_t first = AddVertices(quadCount * 4);
+            int32_t* indices = AddIndices(quadCount * 6);
+
+            for (size_t i = 0; i < quadCount * 4; i++)
+            {
+                UIVertex vertex = vertices[i];
+                vertex.position.x = vertex.position.x * unitsPerPixel + offset.x;
+                vertex.position.y = vertex.position.y * unitsPerPixel + offset.y;
+                vertex.position.z *= unitsPerPixel;
+                SetVertex(first + (int32_t)i, vertex);
+            }
+
+            for (size_t quad = 0; quad < quadCount; quad++)
+                WriteQuadIndices(indices + quad * 6, first + (int32_t)quad * 4);
+        }
+
+        /// Channel pointers for uploading straight into a mesh; valid until the next append or Clear.
+        MeshData GetMeshData() const
+        {
+            MeshData data;
+            data.vertexCount = m_Positions.size();
+            data.indexCount = m_Indices.size();
+            data.positions = m_Positions.data();
+            data.colors = m_Colors.data();
+            data.uv0 = m_Uv0.data();
+            data.uv1 = m_Uv1.data();
+            data.uv2 = m_Uv2.data();
+            data.uv3 = m_Uv3.data();
+            data.normals = m_Normals.data();
+            data.tangents = m_Tangents.data();
+            data.indices = m_Indices.data();
+            return data;
+        }
+
+        UIVector3* GetPositions() { return m_Positions.data(); }
+        UIColor32* GetColors() { return m_Colors.data(); }
+        UIVector2* GetUv0() { return m_Uv0.data(); }
+
+        UIVertex GetVertex(int32_t index) const
+        {
+            UIVertex vertex;
+            vertex.position = m_Positions[index];
+            vertex.normal = m_Normals[index];
+            vertex.tangent = m_Tangents[index];
+            vertex.color = m_Colors[index];
+            vertex.uv0 = m_Uv0[index];
+            vertex.uv1 = m_Uv1[index];
+            vertex.uv2 = m_Uv2[index];
+            vertex.uv3 = m_Uv3[index];
+            return vertex;
+        }
+
+        void SetVertex(int32_t index, const UIVertex& vertex)
+        {
+            m_Positions[index] = vertex.position;
+            m_Normals[index] = vertex.normal;
+            m_Tangents[index] = vertex.tangent;
+            m_Colors[index] = vertex.color;
+            m_Uv0[index] = vertex.uv0;
+            m_Uv1[index] = vertex.uv1;
+            m_Uv2[index] = vertex.uv2;
+            m_Uv3[index] = vertex.uv3;
+        }
+
+        /// VertexHelper.GetUIVertexStream: one UIVertex per index, for mesh effects.
+        void GetVertexStream(UIVertex* output) const
+        {
+            for (size_t i = 0; i < m_Indices.size(); i++)
+                output[i] = GetVertex(m_Indices[i]);
+        }
+
+    private:
+        void WriteRect(int32_t first, UIVector2 min, UIVector2 max, UIColor32 color, UIVector2 uvMin, UIVector2 uvMax)
+        {
+            UIVector3* positions = &m_Positions[first];
+            UIVector2* uvs = &m_Uv0[first];
+            UIColor32* colors = &m_Colors[first];
+
+            positions[0].x = min.x; positions[0].y = min.y; positions[0].z = 0.0f;
+            positions[1].x = min.x; positions[1].y = max.y; positions[1].z = 0.0f;
+            positions[2].x = max.x; positions[2].y = max.y; positions[2].z = 0.0f;
+            positions[3].x = max.x; positions[3].y = min.y; positions[3].z = 0.0f;
+
+            uvs[0].x = uvMin.x; uvs[0].y = uvMin.y;
+            uvs[1].x = uvMin.x; uvs[1].y = uvMax.y;
+            uvs[2].x = uvMax.x; uvs[2].y = uvMax.y;
+            uvs[3].x = uvMax.x; uvs[3].y = uvMin.y;
+
+            colors[0] = colors[1] = colors[2] = colors[3] = color;
+        }
+
+        static void WriteQuadIndices(int32_t* indices, int32_t first)
+        {
+            indices[0] = first;
+            indices[1] = first + 1;
+            indices[2] = first + 2;
+            indices[3] = first + 2;
+            indices[4] = first + 3;
+            indices[5] = first;
+        }
+
+        void AddQuadIndices(int32_t first)
+        {
+            WriteQuadIndices(AddIndices(6), first);
+        }
+
+        void TrimTo(int32_t vertexCount, const int32_t* indicesEnd)
+        {
+            size_t indexCount = indicesEnd - m_Indices.data();
+            m_Positions.resize_uninitialized(vertexCount);
+            m_Colors.resize_uninitialized(vertexCount);
+            m_Uv0.resize_uninitialized(vertexCount);
+            m_Uv1.resize_uninitialized(vertexCount);
+            m_Uv2.resize_uninitialized(vertexCount);
+            m_Uv3.resize_uninitialized(vertexCount);
+            m_Normals.resize_uninitialized(vertexCount);
+            m_Tangents.resize_uninitialized(vertexCount);
+            m_Indices.resize_uninitialized(indexCount);
+        }
+
+        dynamic_array<UIVector3> m_Positions;
+        dynamic_array<UIColor32> m_Colors;
+        dynamic_array<UIVector2> m_Uv0;
+        dynamic_array<UIVector2> m_Uv1;
+        dynamic_array<UIVector2> m_Uv2;
+        dynamic_array<UIVector2> m_Uv3;
+        dynamic_array<UIVector3> m_Normals;
+        dynamic_array<UIVector4> m_Tangents;
+        dynamic_array<int32_t> m_Indices;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
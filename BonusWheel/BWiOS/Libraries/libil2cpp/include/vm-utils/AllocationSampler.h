@@ -0,0 +1,282 @@
+#pragma once
+
+#include "il2cpp-config.h"
+
+#if IL2CPP_ENABLE_PROFILER
+
+#include "il2cpp-api-types.h"
+#include "il2cpp-class-internals.h"
+#include "os/Atomic.h"
+#include "os/Mutex.h"
+#include "os/Thread.h"
+#include "os/ThreadLocalValue.h"
+#include "os/Time.h"
+#include "utils/FileUtils.h"
+#include "utils/NonCopyable.h"
+#include "vm/Object.h"
+#include "vm/Profiler.h"
+#include "vm/StackTrace.h"
+#include "vm-utils/StackSampleTree.h"
+#include <algorithm>
+#include <map>
+#include <math.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Sampled allocation profiler built on vm::Profiler::InstallAllocation.
+///
+/// Instead of recording every allocation, each thread draws the number of bytes until its
+/// next sample from an exponential distribution with the configured mean, which makes
+/// the samples a Poisson process over allocated bytes: large objects are proportionally
+/// more likely to be seen, and scaling each sample by size / (1 - e^(-size / mean))
+/// gives an unbiased estimate of the bytes allocated at each site. Allocations that are
+/// not sampled cost a subtraction.
+///
+/// Samples are aggregated into a per call site (allocated class, allocating method) table
+/// for GetTopAllocators and into a call tree for WriteCollapsedStacks.
+    class AllocationSampler : public il2cpp::utils::NonCopyable
+    {
+    public:
+        static const uint32_t kDefaultBytesPerSample = 512 * 1024;
+
+        struct CallsiteStats
+        {
+            Il2CppClass* klass;
+            const MethodInfo* method;
+            uint64_t samples;
+            uint64_t estimatedBytes;
+        };
+
+        static AllocationSampler& Get()
+        {
+            static AllocationSampler s_Sampler;
+            return s_Sampler;
+        }
+
+        /// Starts sampling, installing the sampler as a VM profiler on first use.
+        void Start(uint32_t meanBytesPerSample = kDefaultBytesPerSample)
+        {
+            m_MeanBytesPerSample = meanBytesPerSample;
+            InstallProfilerHooks();
+            os::Atomic::Exchange(&m_Sampling, 1);
+        }
+
+        /// Stops sampling. The allocation hook stays installed, as vm::Profiler cannot
+        /// remove a profiler, and returns right away until the next Start.
+        void Stop()
+        {
+            os::Atomic::Exchange(&m_Sampling, 0);
+        }
+
+        void Reset()
+        {
+            os::FastAutoLock lock(&m_Mutex);
+            m_Callsites.clear();
+            m_Tree.Clear();
+        }
+
+        /// Call sites ordered by estimated allocated bytes, largest first.
+        std::vector<CallsiteStats> GetTopAllocators(size_t count)
+        {
+            std::vector<CallsiteStats> result;
+            {
+                os::FastAutoLock lock(&m_Mutex);
+                result.reserve(m_Callsites.size());
+                for (CallsiteMap::const_iterator it = m_Callsites.begin(); it != m_Callsites.end(); ++it)
+                    result.push_back(it->second);
+            }
+
+            std::sort(result.begin(), result.end(), CompareEstimatedBytes);
+            if (result.size() > count)
+                result.resize(count);
+            return result;
+        }
+
+        bool WriteTopAllocators(const std::string& path, size_t count)
+        {
+            std::vector<CallsiteStats> top = GetTopAllocators(count);
+
+            std::string output = "estimated_bytes\tsamples\tclass\tallocated_in\n";
+            for (size_t i = 0; i < top.size(); i++)
+            {
+                char numbers[64];
+                snprintf(numbers, sizeof(numbers), "%llu\t%llu\t", (unsigned long long)top[i].estimatedBytes, (unsigned long long)top[i].samples);
+                output += numbers;
+                if (top[i].klass->namespaze != NULL && top[i].klass->namespaze[0] != '\0')
+                {
+                    output += top[i].klass->namespaze;
+                    output += '.';
+                }
+                output += top[i].klass->name;
+                output += '\t';
+                if (top[i].method != NULL)
+                    StackSampleTree::AppendFrameName(top[i].method, output);
+                else
+                    output += "<native>";
+                output += '\n';
+            }
+
+            return FileUtils::WriteAll(path, output);
+        }
+
+        /// Allocation call tree weighted by estimated bytes, in collapsed-stack format.
+        bool WriteCollapsedStacks(const std::string& path)
+        {
+            std::string output;
+            {
+                os::FastAutoLock lock(&m_Mutex);
+                m_Tree.WriteCollapsed(output);
+            }
+            return FileUtils::WriteAll(path, output);
+        }
+
+    private:
+        typedef std::pair<Il2CppClass*, const MethodInfo*> CallsiteKey;
+        typedef std::map<CallsiteKey, CallsiteStats> CallsiteMap;
+
+        struct ThreadState
+        {
+            int64_t bytesUntilSample;
+            uint64_t randomState;
+        };
+
+        AllocationSampler()
+            : m_MeanBytesPerSample(kDefaultBytesPerSample), m_Installed(0), m_Sampling(0)
+        {
+        }
+
+        static bool CompareEstimatedBytes(const CallsiteStats& left, const CallsiteStats& right)
+        {
+            return left.estimatedBytes > right.estimatedBytes;
+        }
+
+        // vm::Profiler::SetEvents only updates the most recently installed profiler, so the
+        // events are set right after installing, and only once: installing again would
+        // register the callbacks twice.
+        void InstallProfilerHooks()
+        {
+            if (os::Atomic::CompareExchange(&m_Installed, 1, 0) != 0)
+                return;
+
+            vm::Profiler::Install(reinterpret_cast<Il2CppProfiler*>(this), OnShutdown);
+            vm::Profiler::InstallAllocation(OnAllocation);
+            vm::Profiler::InstallThread(OnThreadStart, OnThreadEnd);
+            vm::Profiler::SetEvents((Il2CppProfileFlags)(IL2CPP_PROFILE_ALLOCATIONS | IL2CPP_PROFILE_THREADS));
+        }
+
+        static void OnShutdown(Il2CppProfiler*)
+        {
+        }
+
+        static void OnThreadStart(Il2CppProfiler*, unsigned long)
+        {
+        }
+
+        // Raised on the exiting thread. Threads the VM never attached are not reported, and
+        // their state is leaked.
+        static void OnThreadEnd(Il2CppProfiler* profiler, unsigned long)
+        {
+            AllocationSampler* sampler = reinterpret_cast<AllocationSampler*>(profiler);
+            void* value = NULL;
+            sampler->m_ThreadState.GetValue(&value);
+            if (value == NULL)
+                return;
+
+            sampler->m_ThreadState.SetValue(NULL);
+            delete static_cast<ThreadState*>(value);
+        }
+
+        static void OnAllocation(Il2CppProfiler*, Il2CppObject* obj, Il2CppClass* klass)
+        {
+            AllocationSampler& sampler = Get();
+            if (sampler.m_Sampling != 0)
+                sampler.OnAllocation(obj, klass);
+        }
+
+        static void CollectFrame(const Il2CppStackFrameInfo* info, void* context)
+        {
+            static_cast<std::vector<const MethodInfo*>*>(context)->push_back(info->method);
+        }
+
+        void OnAllocation(Il2CppObject* obj, Il2CppClass* klass)
+        {
+            ThreadState* state = GetThreadState();
+            uint32_t size = vm::Object::GetSize(obj);
+
+            state->bytesUntilSample -= size;
+            if (state->bytesUntilSample > 0)
+                return;
+
+            state->bytesUntilSample = NextSampleInterval(state);
+            RecordSample(klass, size);
+        }
+
+        IL2CPP_NO_INLINE void RecordSample(Il2CppClass* klass, uint32_t size)
+        {
+            double mean = (double)m_MeanBytesPerSample;
+            uint64_t estimatedBytes = (uint64_t)(size / (1.0 - exp(-(double)size / mean)));
+
+            std::vector<const MethodInfo*> frames;
+            vm::StackTrace::WalkFrameStack(CollectFrame, &frames);
+
+            os::FastAutoLock lock(&m_Mutex);
+
+            CallsiteKey key(klass, frames.empty() ? NULL : frames[0]);
+            CallsiteMap::iterator it = m_Callsites.find(key);
+            if (it == m_Callsites.end())
+            {
+                CallsiteStats stats = { klass, key.second, 0, 0 };
+                it = m_Callsites.insert(std::make_pair(key, stats)).first;
+            }
+            it->second.samples++;
+            it->second.estimatedBytes += estimatedBytes;
+
+            if (!frames.empty())
+                m_Tree.AddSample(&frames[0], frames.size(), estimatedBytes);
+        }
+
+        int64_t NextSampleInterval(ThreadState* state)
+        {
+            // xorshift64*, then map the top 53 bits to a uniform (0, 1] for the exponential draw.
+            state->randomState ^= state->randomState >> 12;
+            state->randomState ^= state->randomState << 25;
+            state->randomState ^= state->randomState >> 27;
+            uint64_t bits = state->randomState * 0x2545F4914F6CDD1DULL;
+            double uniform = ((bits >> 11) + 1) * (1.0 / 9007199254740992.0);
+            return (int64_t)(-log(uniform) * m_MeanBytesPerSample) + 1;
+        }
+
+        ThreadState* GetThreadState()
+        {
+            void* value = NULL;
+            m_ThreadState.GetValue(&value);
+            if (value != NULL)
+                return static_cast<ThreadState*>(value);
+
+            ThreadState* state = new ThreadState();
+            state->randomState = (uint64_t)os::Thread::CurrentThreadId() * 0x9E3779B97F4A7C15ULL ^ (uint64_t)os::Time::GetTicks100NanosecondsMonotonic();
+            if (state->randomState == 0)
+                state->randomState = 1;
+            state->bytesUntilSample = NextSampleInterval(state);
+            m_ThreadState.SetValue(state);
+            return state;
+        }
+
+        uint32_t m_MeanBytesPerSample;
+        volatile int32_t m_Installed;
+        volatile int32_t m_Sampling;
+        os::ThreadLocalValue m_ThreadState;
+
+        os::FastMutex m_Mutex;
+        CallsiteMap m_Callsites;
+        StackSampleTree m_Tree;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
+
+#endif // IL2CPP_ENABLE_PROFILER
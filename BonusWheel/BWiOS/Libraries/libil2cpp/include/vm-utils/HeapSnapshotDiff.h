@@ -0,0 +1,297 @@
+#pragma once
+
+#include "vm-utils/HeapSnapshotFormat.h"
+#include <algorithm>
+#include <map>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Offline reader for files produced by HeapSnapshotWriter that reports type level growth
+/// between two snapshots. It has no runtime dependencies so it can be compiled into a
+/// small host tool linked against zlib (-lz):
+///
+///     std::string report;
+///     if (HeapSnapshotDiff::Run(argv[1], argv[2], report))
+///         fputs(report.c_str(), stdout);
+///
+/// Objects are found by scanning every allocation granule of the heap for a word that
+/// matches the address of a reported class, which is where every managed object keeps
+/// its class pointer. Freed-but-unswept objects are counted as well and a value type
+/// field that happens to hold a class address can produce a false positive, so counts
+/// are approximate; differences between two snapshots of the same session are what
+/// this is meant for.
+    class HeapSnapshotDiff
+    {
+    public:
+        struct TypeCensus
+        {
+            std::string name;
+            std::string assemblyName;
+            uint64_t count;
+            uint64_t bytes;
+        };
+
+        // Keyed by "assembly:type" so that snapshots taken in different runs line up.
+        typedef std::map<std::string, TypeCensus> Census;
+
+        static bool Run(const char* beforePath, const char* afterPath, std::string& report)
+        {
+            Census before;
+            Census after;
+            if (!LoadCensus(beforePath, before, report) || !LoadCensus(afterPath, after, report))
+                return false;
+
+            Diff(before, after, report);
+            return true;
+        }
+
+        static bool LoadCensus(const char* path, Census& census, std::string& error)
+        {
+            FILE* file = fopen(path, "rb");
+            if (file == NULL)
+            {
+                error = std::string("cannot open ") + path + "\n";
+                return false;
+            }
+
+            Reader reader(file, census);
+            bool succeeded = reader.Read();
+            fclose(file);
+            if (!succeeded)
+                error = std::string("malformed snapshot ") + path + "\n";
+            return succeeded;
+        }
+
+        /// Appends a tab separated table of every type whose instance count or size changed,
+        /// largest byte growth first.
+        static void Diff(const Census& before, const Census& after, std::string& report)
+        {
+            std::vector<Growth> growth;
+            TypeCensus empty = { "", "", 0, 0 };
+
+            for (Census::const_iterator it = after.begin(); it != after.end(); ++it)
+            {
+                Census::const_iterator old = before.find(it->first);
+                AddGrowth(old != before.end() ? old->second : empty, it->second, growth);
+            }
+
+            for (Census::const_iterator it = before.begin(); it != before.end(); ++it)
+            {
+                if (after.find(it->first) == after.end())
+                {
+                    TypeCensus gone = it->second;
+                    gone.count = 0;
+                    gone.bytes = 0;
+                    AddGrowth(it->second, gone, growth);
+                }
+            }
+
+            std::sort(growth.begin(), growth.end(), CompareByteGrowth);
+
+            report += "delta_bytes\tdelta_count\tbytes_before\tbytes_after\tcount_before\tcount_after\ttype\n";
+            for (size_t i = 0; i < growth.size(); i++)
+            {
+                const Growth& entry = growth[i];
+                char numbers[160];
+                snprintf(numbers, sizeof(numbers), "%lld\t%lld\t%llu\t%llu\t%llu\t%llu\t",
+                    (long long)(entry.after.bytes - entry.before.bytes), (long long)(entry.after.count - entry.before.count),
+                    (unsigned long long)entry.before.bytes, (unsigned long long)entry.after.bytes,
+                    (unsigned long long)entry.before.count, (unsigned long long)entry.after.count);
+                report += numbers;
+                report += entry.after.assemblyName.empty() ? entry.before.assemblyName : entry.after.assemblyName;
+                report += ':';
+                report += entry.after.name.empty() ? entry.before.name : entry.after.name;
+                report += '\n';
+            }
+        }
+
+    private:
+        struct Growth
+        {
+            TypeCensus before;
+            TypeCensus after;
+            int64_t byteGrowth;
+        };
+
+        static void AddGrowth(const TypeCensus& before, const TypeCensus& after, std::vector<Growth>& growth)
+        {
+            if (before.count == after.count && before.bytes == after.bytes)
+                return;
+
+            growth.push_back(Growth());
+            Growth& entry = growth.back();
+            entry.before = before;
+            entry.after = after;
+            entry.byteGrowth = (int64_t)(after.bytes - before.bytes);
+        }
+
+        static bool CompareByteGrowth(const Growth& left, const Growth& right)
+        {
+            return left.byteGrowth > right.byteGrowth;
+        }
+
+        struct TypeInfo
+        {
+            uint32_t instanceSize;
+            uint32_t elementSize;
+            uint32_t flags;
+            TypeCensus* census;
+        };
+
+        class Reader
+        {
+        public:
+            Reader(FILE* file, Census& census)
+                : m_File(file), m_Census(census)
+            {
+            }
+
+            bool Read()
+            {
+                if (fread(&m_Header, sizeof(m_Header), 1, m_File) != 1
+                    || memcmp(m_Header.magic, kHeapSnapshotMagic, sizeof(m_Header.magic)) != 0
+                    || m_Header.version != kHeapSnapshotVersion
+                    || (m_Header.pointerSize != 4 && m_Header.pointerSize != 8)
+                    || m_Header.allocationGranularity == 0)
+                    return false;
+
+                // Chunks can only be scanned once every type is known, and the writer puts the
+                // types last, so the records are read twice.
+                return ReadRecords(kHeapSnapshotRecordType)
+                    && fseek(m_File, (long)sizeof(m_Header), SEEK_SET) == 0
+                    && ReadRecords(kHeapSnapshotRecordHeapChunk);
+            }
+
+        private:
+            bool ReadRecords(uint32_t tag)
+            {
+                std::vector<uint8_t> payload;
+                std::vector<uint8_t> chunk(kHeapSnapshotChunkSize);
+                HeapSnapshotRecordHeader record;
+                while (fread(&record, sizeof(record), 1, m_File) == 1)
+                {
+                    if (record.tag == kHeapSnapshotRecordEnd)
+                        return true;
+
+                    if (record.tag != tag)
+                    {
+                        if (fseek(m_File, (long)record.payloadSize, SEEK_CUR) != 0)
+                            return false;
+                        continue;
+                    }
+
+                    payload.resize((size_t)record.payloadSize);
+                    if (!payload.empty() && fread(&payload[0], payload.size(), 1, m_File) != 1)
+                        return false;
+
+                    bool valid = tag == kHeapSnapshotRecordType ? ReadType(payload) : ReadHeapChunk(payload, chunk);
+                    if (!valid)
+                        return false;
+                }
+
+                return false;
+            }
+
+            bool ReadType(const std::vector<uint8_t>& payload)
+            {
+                uint64_t address;
+                uint32_t sizes[5];
+                if (payload.size() < sizeof(address) + sizeof(sizes))
+                    return false;
+                memcpy(&address, &payload[0], sizeof(address));
+                memcpy(sizes, &payload[sizeof(address)], sizeof(sizes));
+                if (payload.size() != sizeof(address) + sizeof(sizes) + sizes[3] + sizes[4])
+                    return false;
+
+                const char* strings = reinterpret_cast<const char*>(&payload[sizeof(address) + sizeof(sizes)]);
+                std::string name(strings, sizes[3]);
+                std::string assemblyName(strings + sizes[3], sizes[4]);
+
+                TypeCensus& census = m_Census[assemblyName + ":" + name];
+                census.name = name;
+                census.assemblyName = assemblyName;
+
+                // Value types never live on the heap unboxed, but boxed ones carry the same class pointer.
+                TypeInfo info = { sizes[0], sizes[1], sizes[2], &census };
+                m_Types[address] = info;
+                return true;
+            }
+
+            bool ReadHeapChunk(const std::vector<uint8_t>& payload, std::vector<uint8_t>& chunk)
+            {
+                uint64_t address;
+                uint32_t rawSize;
+                if (payload.size() < sizeof(address) + sizeof(rawSize))
+                    return false;
+                memcpy(&address, &payload[0], sizeof(address));
+                memcpy(&rawSize, &payload[sizeof(address)], sizeof(rawSize));
+                if (rawSize > kHeapSnapshotChunkSize)
+                    return false;
+
+                size_t headerSize = sizeof(address) + sizeof(rawSize);
+                if (!HeapSnapshotEncoding::Decode(payload.size() > headerSize ? &payload[headerSize] : NULL, payload.size() - headerSize, &chunk[0], rawSize))
+                    return false;
+
+                uint32_t pointerSize = m_Header.pointerSize;
+                for (uint32_t offset = 0; offset + pointerSize <= rawSize; offset += m_Header.allocationGranularity)
+                {
+                    std::map<uint64_t, TypeInfo>::const_iterator type = m_Types.find(ReadWord(&chunk[offset]));
+                    if (type == m_Types.end())
+                        continue;
+
+                    type->second.census->count++;
+                    type->second.census->bytes += ObjectSize(type->second, &chunk[offset], rawSize - offset);
+                }
+
+                return true;
+            }
+
+            uint64_t ObjectSize(const TypeInfo& type, const uint8_t* object, uint32_t available) const
+            {
+                if (type.flags & kHeapSnapshotTypeString)
+                {
+                    int32_t length;
+                    if (m_Header.objectHeaderSize + sizeof(length) > available)
+                        return type.instanceSize;
+                    memcpy(&length, object + m_Header.objectHeaderSize, sizeof(length));
+                    return m_Header.objectHeaderSize + sizeof(length) + ((uint64_t)length + 1) * 2;
+                }
+
+                if (type.flags & kHeapSnapshotTypeArray)
+                {
+                    if (m_Header.arraySizeOffsetInHeader + m_Header.pointerSize > available)
+                        return m_Header.arrayHeaderSize;
+                    return m_Header.arrayHeaderSize + ReadWord(object + m_Header.arraySizeOffsetInHeader) * type.elementSize;
+                }
+
+                return type.instanceSize;
+            }
+
+            uint64_t ReadWord(const uint8_t* data) const
+            {
+                if (m_Header.pointerSize == 8)
+                {
+                    uint64_t value;
+                    memcpy(&value, data, sizeof(value));
+                    return value;
+                }
+
+                uint32_t value;
+                memcpy(&value, data, sizeof(value));
+                return value;
+            }
+
+            FILE* m_File;
+            Census& m_Census;
+            HeapSnapshotHeader m_Header;
+            std::map<uint64_t, TypeInfo> m_Types;
+        };
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
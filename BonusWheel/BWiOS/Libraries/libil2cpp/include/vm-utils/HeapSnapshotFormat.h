@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include <zlib.h>
+
+// On-disk layout shared by HeapSnapshotWriter and the offline HeapSnapshotDiff reader.
+// This header must not depend on the runtime so that the reader can be built on its own.
+//
+// The file starts with a HeapSnapshotHeader and is followed by records, each made of a
+// HeapSnapshotRecordHeader and payloadSize bytes of payload:
+//
+//   kHeapSnapshotRecordType        uint64 class address, uint32 instance size, uint32 element size,
+//                                  uint32 flags, uint32 name length, uint32 assembly name length,
+//                                  name bytes, assembly name bytes
+//   kHeapSnapshotRecordHeapChunk   uint64 start address, uint32 raw size, encoded bytes
+//   kHeapSnapshotRecordGCHandles   uint64 object addresses, as many as fit the payload
+//   kHeapSnapshotRecordEnd         empty
+//
+// Records can come in any order; the writer puts the type records after the heap chunks.
+// Heap chunks are at most kHeapSnapshotChunkSize raw bytes and are zlib streams, see
+// HeapSnapshotEncoding. All values are in the byte order of the device that wrote the file.
+
+namespace il2cpp
+{
+namespace utils
+{
+    static const char kHeapSnapshotMagic[8] = { 'I', 'L', '2', 'H', 'S', 'N', 'A', 'P' };
+    static const uint32_t kHeapSnapshotVersion = 3;
+    static const uint32_t kHeapSnapshotChunkSize = 64 * 1024;
+
+    enum HeapSnapshotRecordTag
+    {
+        kHeapSnapshotRecordType = 1,
+        kHeapSnapshotRecordHeapChunk = 2,
+        kHeapSnapshotRecordGCHandles = 3,
+        kHeapSnapshotRecordEnd = 0xFFFFFFFF
+    };
+
+    // Same meaning as Il2CppMetadataTypeFlags, plus a flag for System.String whose size
+    // depends on its length field.
+    enum HeapSnapshotTypeFlags
+    {
+        kHeapSnapshotTypeValueType = 1 << 0,
+        kHeapSnapshotTypeArray = 1 << 1,
+        kHeapSnapshotTypeString = 1 << 2,
+        kHeapSnapshotTypeArrayRankMask = 0xFFFF0000
+    };
+
+    struct HeapSnapshotHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t pointerSize;
+        uint32_t objectHeaderSize;
+        uint32_t arrayHeaderSize;
+        uint32_t arraySizeOffsetInHeader;
+        uint32_t allocationGranularity;
+    };
+
+    struct HeapSnapshotRecordHeader
+    {
+        uint32_t tag;
+        uint32_t reserved;
+        uint64_t payloadSize;
+    };
+
+    /// Heap chunks are compressed with zlib, which ships with the OS on every platform the
+    /// writer runs on. Managed heaps are dominated by zeroed memory (free blocks, cleared
+    /// fields, unused array capacity), which deflate collapses at its fastest level.
+    class HeapSnapshotEncoding
+    {
+    public:
+        static size_t MaxEncodedSize(size_t size)
+        {
+            return compressBound((uLong)size);
+        }
+
+        static bool Encode(const uint8_t* source, size_t size, std::vector<uint8_t>& output)
+        {
+            size_t offset = output.size();
+            uLongf encodedSize = compressBound((uLong)size);
+            output.resize(offset + encodedSize);
+            if (compress2(&output[offset], &encodedSize, source, (uLong)size, Z_BEST_SPEED) != Z_OK)
+            {
+                output.resize(offset);
+                return false;
+            }
+
+            output.resize(offset + encodedSize);
+            return true;
+        }
+
+        /// Returns false if the encoded data is malformed or does not decode to exactly size bytes.
+        static bool Decode(const uint8_t* source, size_t sourceSize, uint8_t* destination, size_t size)
+        {
+            uLongf decodedSize = (uLongf)size;
+            return source != NULL
+                && uncompress(destination, &decodedSize, source, (uLong)sourceSize) == Z_OK
+                && decodedSize == size;
+        }
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
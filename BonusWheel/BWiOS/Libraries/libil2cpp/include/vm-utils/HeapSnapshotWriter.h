@@ -0,0 +1,267 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "il2cpp-class-internals.h"
+#include "il2cpp-object-internals.h"
+#include "gc/GarbageCollector.h"
+#include "gc/GCHandle.h"
+#include "os/File.h"
+#include "utils/NonCopyable.h"
+#include "vm/MemoryInformation.h"
+#include "vm-utils/HeapSnapshotFormat.h"
+#include <algorithm>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Writes a managed heap snapshot straight to a file.
+///
+/// vm::MemoryInformation::CaptureManagedMemorySnapshot copies every heap section into
+/// one allocation before anything can be saved, which doubles peak memory. This writer
+/// walks the same sources (classes, GC heap sections, strong GC handles) but encodes the
+/// heap in kHeapSnapshotChunkSize pieces as it goes, so the extra memory is one chunk
+/// plus the write buffer regardless of heap size. The format is described in
+/// HeapSnapshotFormat.h; HeapSnapshotDiff compares two files offline.
+///
+/// Only the list of heap sections and the strong GC handle targets are taken with the world
+/// stopped. The collector stays disabled from then until every section is written, so no
+/// section is unmapped or reused while it is read. Threads keep running, though: objects
+/// that change during the capture may be saved in either state, and objects allocated
+/// meanwhile may be missing. Classes are reported last, which covers every class that has
+/// an instance in the saved chunks.
+    class HeapSnapshotWriter : public il2cpp::utils::NonCopyable
+    {
+    public:
+        static bool Capture(const std::string& path)
+        {
+            int error;
+            os::FileHandle* file = os::File::Open(path, kFileModeCreate, kFileAccessWrite, kFileShareNone, kFileOptionsNone, &error);
+            if (error != os::kErrorCodeSuccess)
+                return false;
+
+            HeapSnapshotWriter writer(file);
+            writer.WriteHeader();
+
+            // A stopped thread may hold the malloc or the file lock, so nothing allocates or
+            // writes while the world is stopped: sections and handle targets are collected
+            // into storage reserved up front. If the heap or the handle table grew past that
+            // in the meantime, the capacity is raised and the world is stopped again.
+            gc::GarbageCollector::Disable();
+            do
+            {
+                writer.ReserveForStoppedWorld();
+
+                gc::GarbageCollector::StopWorld();
+                writer.m_Overflowed = false;
+                writer.m_Sections.clear();
+                writer.m_GCHandleTargets.clear();
+                gc::GarbageCollector::ForEachHeapSection(&writer, CollectHeapSection);
+                gc::GCHandle::WalkStrongGCHandleTargets(CollectGCHandleTarget, &writer);
+                gc::GarbageCollector::StartWorld();
+            }
+            while (writer.m_Overflowed);
+
+            for (size_t i = 0; i < writer.m_Sections.size(); i++)
+                writer.WriteHeapSection(writer.m_Sections[i].start, writer.m_Sections[i].end);
+            gc::GarbageCollector::Enable();
+            vm::MemoryInformation::ReportIL2CppClasses(ReportClass, &writer);
+            writer.WriteGCHandles();
+            writer.WriteRecordHeader(kHeapSnapshotRecordEnd, 0);
+            writer.Flush();
+
+            bool succeeded = writer.m_Succeeded;
+            os::File::Close(file, &error);
+            return succeeded && error == os::kErrorCodeSuccess;
+        }
+
+    private:
+        static const size_t kWriteBufferSize = 256 * 1024;
+
+        // Headroom for sections and handles added between reserving and stopping the world.
+        static const size_t kSectionSlack = 16;
+        static const size_t kGCHandleSlack = 256;
+
+        struct HeapSection
+        {
+            const uint8_t* start;
+            const uint8_t* end;
+        };
+
+        HeapSnapshotWriter(os::FileHandle* file)
+            : m_File(file), m_Succeeded(true), m_Overflowed(false)
+        {
+            m_Buffer.reserve(kWriteBufferSize);
+            m_Encoded.reserve(HeapSnapshotEncoding::MaxEncodedSize(kHeapSnapshotChunkSize));
+        }
+
+        void WriteHeader()
+        {
+            HeapSnapshotHeader header;
+            memcpy(header.magic, kHeapSnapshotMagic, sizeof(header.magic));
+            header.version = kHeapSnapshotVersion;
+            header.pointerSize = sizeof(void*);
+            header.objectHeaderSize = sizeof(Il2CppObject);
+            header.arrayHeaderSize = kIl2CppSizeOfArray;
+            header.arraySizeOffsetInHeader = kIl2CppOffsetOfArrayLength;
+            header.allocationGranularity = 2 * sizeof(void*);
+            Write(&header, sizeof(header));
+        }
+
+        void WriteRecordHeader(uint32_t tag, uint64_t payloadSize)
+        {
+            HeapSnapshotRecordHeader header = { tag, 0, payloadSize };
+            Write(&header, sizeof(header));
+        }
+
+        static void ReportClass(Il2CppClass* klass, void* context)
+        {
+            HeapSnapshotWriter* writer = static_cast<HeapSnapshotWriter*>(context);
+
+            std::string name;
+            if (klass->namespaze != NULL && klass->namespaze[0] != '\0')
+            {
+                name = klass->namespaze;
+                name += '.';
+            }
+            name += klass->name;
+            for (uint8_t i = 0; i < klass->rank; i++)
+                name += i == 0 ? "[" : ",";
+            if (klass->rank != 0)
+                name += "]";
+            const char* assemblyName = klass->image != NULL ? klass->image->nameNoExt : "";
+
+            uint64_t address = (uint64_t)(uintptr_t)klass;
+            uint32_t flags = 0;
+            if (klass->valuetype)
+                flags |= kHeapSnapshotTypeValueType;
+            if (klass->rank != 0)
+                flags |= kHeapSnapshotTypeArray | ((uint32_t)klass->rank << 16);
+            if (klass == il2cpp_defaults.string_class)
+                flags |= kHeapSnapshotTypeString;
+            uint32_t sizes[5] = { klass->instance_size, klass->element_size, flags, (uint32_t)name.size(), (uint32_t)strlen(assemblyName) };
+
+            writer->WriteRecordHeader(kHeapSnapshotRecordType, sizeof(address) + sizeof(sizes) + sizes[3] + sizes[4]);
+            writer->Write(&address, sizeof(address));
+            writer->Write(sizes, sizeof(sizes));
+            writer->Write(name.c_str(), sizes[3]);
+            writer->Write(assemblyName, sizes[4]);
+        }
+
+        static void CountGCHandleTarget(Il2CppObject*, void* context)
+        {
+            (*static_cast<size_t*>(context))++;
+        }
+
+        // Called with the world running.
+        void ReserveForStoppedWorld()
+        {
+            size_t gcHandleCount = 0;
+            gc::GCHandle::WalkStrongGCHandleTargets(CountGCHandleTarget, &gcHandleCount);
+
+            size_t sectionCapacity = gc::GarbageCollector::GetSectionCount() + kSectionSlack;
+            size_t gcHandleCapacity = gcHandleCount + gcHandleCount / 8 + kGCHandleSlack;
+            if (m_Overflowed)
+            {
+                sectionCapacity = std::max(sectionCapacity, m_Sections.capacity() * 2);
+                gcHandleCapacity = std::max(gcHandleCapacity, m_GCHandleTargets.capacity() * 2);
+            }
+
+            m_Sections.reserve(sectionCapacity);
+            m_GCHandleTargets.reserve(gcHandleCapacity);
+        }
+
+        // The two collectors run with the world stopped and must not allocate.
+        static void CollectHeapSection(void* context, void* start, void* end)
+        {
+            HeapSnapshotWriter* writer = static_cast<HeapSnapshotWriter*>(context);
+            if (writer->m_Sections.size() == writer->m_Sections.capacity())
+            {
+                writer->m_Overflowed = true;
+                return;
+            }
+
+            HeapSection section = { static_cast<const uint8_t*>(start), static_cast<const uint8_t*>(end) };
+            writer->m_Sections.push_back(section);
+        }
+
+        static void CollectGCHandleTarget(Il2CppObject* obj, void* context)
+        {
+            HeapSnapshotWriter* writer = static_cast<HeapSnapshotWriter*>(context);
+            if (writer->m_GCHandleTargets.size() == writer->m_GCHandleTargets.capacity())
+            {
+                writer->m_Overflowed = true;
+                return;
+            }
+
+            writer->m_GCHandleTargets.push_back((uint64_t)(uintptr_t)obj);
+        }
+
+        void WriteHeapSection(const uint8_t* start, const uint8_t* end)
+        {
+            for (const uint8_t* chunk = start; chunk < end; chunk += kHeapSnapshotChunkSize)
+            {
+                size_t remaining = end - chunk;
+                uint32_t rawSize = remaining < kHeapSnapshotChunkSize ? (uint32_t)remaining : kHeapSnapshotChunkSize;
+                uint64_t address = (uint64_t)(uintptr_t)chunk;
+
+                m_Encoded.clear();
+                if (!HeapSnapshotEncoding::Encode(chunk, rawSize, m_Encoded))
+                {
+                    m_Succeeded = false;
+                    return;
+                }
+
+                WriteRecordHeader(kHeapSnapshotRecordHeapChunk, sizeof(address) + sizeof(rawSize) + m_Encoded.size());
+                Write(&address, sizeof(address));
+                Write(&rawSize, sizeof(rawSize));
+                Write(&m_Encoded[0], m_Encoded.size());
+            }
+        }
+
+        void WriteGCHandles()
+        {
+            WriteRecordHeader(kHeapSnapshotRecordGCHandles, m_GCHandleTargets.size() * sizeof(uint64_t));
+            if (!m_GCHandleTargets.empty())
+                Write(&m_GCHandleTargets[0], m_GCHandleTargets.size() * sizeof(uint64_t));
+        }
+
+        void Write(const void* data, size_t size)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            if (m_Buffer.size() + size > kWriteBufferSize)
+                Flush();
+
+            if (size > kWriteBufferSize)
+                WriteToFile(bytes, size);
+            else
+                m_Buffer.insert(m_Buffer.end(), bytes, bytes + size);
+        }
+
+        void Flush()
+        {
+            if (!m_Buffer.empty())
+                WriteToFile(&m_Buffer[0], m_Buffer.size());
+            m_Buffer.clear();
+        }
+
+        void WriteToFile(const uint8_t* data, size_t size)
+        {
+            int error;
+            if (m_Succeeded && os::File::Write(m_File, reinterpret_cast<const char*>(data), (int)size, &error) != (int32_t)size)
+                m_Succeeded = false;
+        }
+
+        os::FileHandle* m_File;
+        bool m_Succeeded;
+        bool m_Overflowed;
+        std::vector<uint8_t> m_Buffer;
+        std::vector<uint8_t> m_Encoded;
+        std::vector<HeapSection> m_Sections;
+        std::vector<uint64_t> m_GCHandleTargets;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,392 @@
+#pragma once
+
+#include "il2cpp-config.h"
+
+#if IL2CPP_ENABLE_PROFILER
+
+#include "il2cpp-api-types.h"
+#include "il2cpp-class-internals.h"
+#include "os/Atomic.h"
+#include "os/Mutex.h"
+#include "os/Thread.h"
+#include "os/ThreadLocalValue.h"
+#include "os/Time.h"
+#include "os/Unity/UnityPlatformConfigure.h"
+#include "os/Unity/ExtendedAtomicOps.h"
+#include "utils/FileUtils.h"
+#include "utils/NonCopyable.h"
+#include "utils/ReadMostlyPointerMap.h"
+#include "vm/Profiler.h"
+#include "vm-utils/StackSampleTree.h"
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Method enter/leave tracer built on vm::Profiler::InstallEnterLeave.
+///
+/// Every thread records timestamped enter and exit events into its own fixed size ring
+/// buffer, so recording takes no locks and the newest events win when a buffer wraps.
+/// Methods are filtered by assembly name or by Class / Namespace.Class / Class:Method;
+/// the decision is cached per MethodInfo so that filtered-out methods cost one hash lookup.
+/// DumpChromeTrace writes the buffers in the Chrome trace event format, which
+/// chrome://tracing, Perfetto and speedscope open directly.
+///
+/// Each buffer holds GetEventsPerThread() events of 24 bytes (192 KB per thread by
+/// default); SetEventsPerThread changes that for threads that start recording later. A
+/// buffer is handed to the next new thread once its thread exits, so memory is bounded by
+/// the peak number of threads that recorded at the same time. Buffers are never freed: a
+/// thread's TLS keeps pointing at its buffer, and an enter or leave that races with the
+/// VM shutdown may still write to it.
+///
+/// Filters can be added at any time. Each change publishes a new filter set with an empty
+/// decision cache, and recording threads keep using the set they loaded until their next
+/// event; superseded sets are kept for the same reason buffers are.
+///
+/// Enter/leave events are only raised by code generated with IL2CPP's profiler hooks.
+    class MethodTracer : public il2cpp::utils::NonCopyable
+    {
+    public:
+        static const size_t kDefaultEventsPerThread = 8 * 1024;
+
+        static MethodTracer& Get()
+        {
+            static MethodTracer s_Tracer;
+            return s_Tracer;
+        }
+
+        /// Assemblies are matched by name with or without extension, e.g. "Assembly-CSharp".
+        void AddAssemblyFilter(const char* assemblyName)
+        {
+            os::FastAutoLock lock(&m_FilterMutex);
+            Filters* filters = new Filters(*os::Atomic::ReadPointer(&m_Filters));
+            filters->assemblies.push_back(assemblyName);
+            os::Atomic::ExchangePointer(&m_Filters, filters);
+        }
+
+        /// Matches "Class", "Namespace.Class", "Class:Method" or "Namespace.Class:Method".
+        void AddMethodFilter(const char* name)
+        {
+            os::FastAutoLock lock(&m_FilterMutex);
+            Filters* filters = new Filters(*os::Atomic::ReadPointer(&m_Filters));
+            filters->methods.push_back(name);
+            os::Atomic::ExchangePointer(&m_Filters, filters);
+        }
+
+        /// Rounded up to a power of two. Applies to buffers created after the call.
+        void SetEventsPerThread(size_t eventCount)
+        {
+            size_t capacity = 1;
+            while (capacity < eventCount)
+                capacity *= 2;
+            os::Atomic::Exchange(&m_EventsPerThread, (int32_t)capacity);
+        }
+
+        size_t GetEventsPerThread()
+        {
+            return (size_t)os::Atomic::CompareExchange(&m_EventsPerThread, 0, 0);
+        }
+
+        /// Starts recording, installing the tracer as a VM profiler on first use.
+        void Start()
+        {
+            InstallProfilerHooks();
+            os::Atomic::Exchange(&m_Recording, 1);
+        }
+
+        /// Stops recording. The enter/leave hooks stay installed, as vm::Profiler cannot
+        /// remove a profiler, and return right away until the next Start.
+        void Stop()
+        {
+            os::Atomic::Exchange(&m_Recording, 0);
+        }
+
+        /// Writes all buffered events. Safe to call while threads are still recording;
+        /// events that get overwritten during the copy are dropped.
+        bool DumpChromeTrace(const std::string& path)
+        {
+            std::string output = "{\"traceEvents\":[\n";
+            bool first = true;
+
+            std::vector<Event> events;
+            for (ThreadBuffer* buffer = os::Atomic::ReadPointer(&m_Buffers); buffer != NULL; buffer = buffer->next)
+            {
+                size_t firstIndex = LoadAcquire(&buffer->firstIndex);
+                os::Thread::ThreadId threadId = buffer->threadId;
+                size_t capacity = buffer->mask + 1;
+                size_t end = LoadAcquire(&buffer->writeIndex);
+                size_t start = end > capacity ? end - capacity : 0;
+                if (start < firstIndex)
+                    start = firstIndex;
+
+                events.resize(end - start);
+                for (size_t i = start; i < end; i++)
+                    events[i - start] = buffer->events[i & buffer->mask];
+
+                // The copy has to be complete before the index is read again. The thread may
+                // be storing event endAfterCopy at that point, and that event reuses the slot
+                // of event endAfterCopy - capacity, so that one is dropped as well.
+                os::atomic_thread_fence(os::memory_order_acquire);
+                size_t endAfterCopy = LoadAcquire(&buffer->writeIndex);
+                size_t firstValid = endAfterCopy >= capacity ? endAfterCopy + 1 - capacity : 0;
+
+                for (size_t i = start < firstValid ? firstValid : start; i < end; i++)
+                {
+                    const Event& event = events[i - start];
+                    output += first ? "" : ",\n";
+                    first = false;
+                    AppendEvent(event, threadId, output);
+                }
+            }
+
+            output += "\n]}\n";
+            return FileUtils::WriteAll(path, output);
+        }
+
+    private:
+        enum EventKind
+        {
+            kEventEnter,
+            kEventExit
+        };
+
+        struct Event
+        {
+            int64_t ticks;
+            const MethodInfo* method;
+            EventKind kind;
+        };
+
+        struct ThreadBuffer
+        {
+            os::Thread::ThreadId threadId;
+            volatile size_t writeIndex;
+            volatile size_t firstIndex;     // events before this one were recorded by an earlier owner
+            volatile int32_t owned;
+            ThreadBuffer* volatile next;
+            size_t mask;
+            Event* events;
+        };
+
+        struct Filters
+        {
+            std::vector<std::string> assemblies;
+            std::vector<std::string> methods;
+            ReadMostlyPointerMap<const MethodInfo*, const void*> decisions;
+
+            Filters()
+            {
+            }
+
+            // Copies the filters only; the new set decides every method again.
+            Filters(const Filters& other)
+                : assemblies(other.assemblies), methods(other.methods)
+            {
+            }
+        };
+
+        MethodTracer()
+            : m_Filters(new Filters()), m_EventsPerThread((int32_t)kDefaultEventsPerThread), m_Installed(0), m_Recording(0), m_Buffers(NULL)
+        {
+        }
+
+        // Sentinel values for the per-method filter cache, which reserves NULL for "not cached".
+        static const void* Traced() { static const char s_Traced = 0; return &s_Traced; }
+        static const void* Skipped() { static const char s_Skipped = 0; return &s_Skipped; }
+
+        static size_t LoadAcquire(const volatile size_t* location)
+        {
+            return (size_t)os::atomic_load_explicit(reinterpret_cast<const volatile atomic_word*>(location), os::memory_order_acquire);
+        }
+
+        static void StoreRelease(volatile size_t* location, size_t value)
+        {
+            os::atomic_store_explicit(reinterpret_cast<volatile atomic_word*>(location), (atomic_word)value, os::memory_order_release);
+        }
+
+        // vm::Profiler::SetEvents only updates the most recently installed profiler, so the
+        // events are set right after installing, and only once: installing again would
+        // register the callbacks twice.
+        void InstallProfilerHooks()
+        {
+            if (os::Atomic::CompareExchange(&m_Installed, 1, 0) != 0)
+                return;
+
+            vm::Profiler::Install(reinterpret_cast<Il2CppProfiler*>(this), OnShutdown);
+            vm::Profiler::InstallEnterLeave(OnMethodEnter, OnMethodExit);
+            vm::Profiler::InstallThread(OnThreadStart, OnThreadEnd);
+            vm::Profiler::SetEvents((Il2CppProfileFlags)(IL2CPP_PROFILE_ENTER_LEAVE | IL2CPP_PROFILE_THREADS));
+        }
+
+        static void OnMethodEnter(Il2CppProfiler* profiler, const MethodInfo* method)
+        {
+            reinterpret_cast<MethodTracer*>(profiler)->Record(method, kEventEnter);
+        }
+
+        static void OnMethodExit(Il2CppProfiler* profiler, const MethodInfo* method)
+        {
+            reinterpret_cast<MethodTracer*>(profiler)->Record(method, kEventExit);
+        }
+
+        static void OnThreadStart(Il2CppProfiler*, unsigned long)
+        {
+        }
+
+        // Raised on the exiting thread: its buffer goes back to the list for the next thread.
+        static void OnThreadEnd(Il2CppProfiler* profiler, unsigned long)
+        {
+            MethodTracer* tracer = reinterpret_cast<MethodTracer*>(profiler);
+            void* value = NULL;
+            tracer->m_CurrentThreadBuffer.GetValue(&value);
+            if (value == NULL)
+                return;
+
+            tracer->m_CurrentThreadBuffer.SetValue(NULL);
+            os::Atomic::Exchange(&static_cast<ThreadBuffer*>(value)->owned, 0);
+        }
+
+        // The buffers stay allocated: other threads' TLS still points at them, and an
+        // enter or leave already past the recording check may still write to one.
+        static void OnShutdown(Il2CppProfiler* profiler)
+        {
+            os::Atomic::Exchange(&reinterpret_cast<MethodTracer*>(profiler)->m_Recording, 0);
+        }
+
+        void Record(const MethodInfo* method, EventKind kind)
+        {
+            if (m_Recording == 0 || !ShouldTrace(method))
+                return;
+
+            ThreadBuffer* buffer = GetCurrentThreadBuffer();
+            size_t index = buffer->writeIndex;
+
+            // Orders the store that published index before this event's stores, so a reader
+            // that sees part of this event also sees that its slot is being reused.
+            os::atomic_thread_fence(os::memory_order_release);
+            Event& event = buffer->events[index & buffer->mask];
+            event.ticks = os::Time::GetTicks100NanosecondsMonotonic();
+            event.method = method;
+            event.kind = kind;
+            StoreRelease(&buffer->writeIndex, index + 1);
+        }
+
+        bool ShouldTrace(const MethodInfo* method)
+        {
+            Filters* filters = os::Atomic::ReadPointer(&m_Filters);
+            if (filters->assemblies.empty() && filters->methods.empty())
+                return true;
+
+            const void* decision = filters->decisions.Get(method);
+            if (decision == NULL)
+            {
+                decision = MatchesFilters(*filters, method) ? Traced() : Skipped();
+                filters->decisions.Add(method, decision);
+            }
+            return decision == Traced();
+        }
+
+        static bool MatchesFilters(const Filters& filters, const MethodInfo* method)
+        {
+            const Il2CppImage* image = method->klass != NULL ? method->klass->image : NULL;
+            for (size_t i = 0; i < filters.assemblies.size() && image != NULL; i++)
+            {
+                if (filters.assemblies[i] == image->name || filters.assemblies[i] == image->nameNoExt)
+                    return true;
+            }
+
+            if (filters.methods.empty() || method->klass == NULL)
+                return false;
+
+            std::string className = method->klass->name;
+            std::string qualifiedClassName = className;
+            if (method->klass->namespaze != NULL && method->klass->namespaze[0] != '\0')
+                qualifiedClassName = std::string(method->klass->namespaze) + "." + className;
+
+            for (size_t i = 0; i < filters.methods.size(); i++)
+            {
+                const std::string& filter = filters.methods[i];
+                if (filter == className || filter == qualifiedClassName
+                    || filter == className + ":" + method->name || filter == qualifiedClassName + ":" + method->name)
+                    return true;
+            }
+
+            return false;
+        }
+
+        ThreadBuffer* GetCurrentThreadBuffer()
+        {
+            void* value = NULL;
+            m_CurrentThreadBuffer.GetValue(&value);
+            if (value != NULL)
+                return static_cast<ThreadBuffer*>(value);
+
+            // Take over the buffer of a thread that has exited. Its events stay readable until
+            // they are overwritten, but are no longer reported once firstIndex moves past them.
+            for (ThreadBuffer* buffer = os::Atomic::ReadPointer(&m_Buffers); buffer != NULL; buffer = buffer->next)
+            {
+                if (buffer->owned != 0 || os::Atomic::CompareExchange(&buffer->owned, 1, 0) != 0)
+                    continue;
+
+                buffer->threadId = os::Thread::CurrentThreadId();
+                StoreRelease(&buffer->firstIndex, buffer->writeIndex);
+                m_CurrentThreadBuffer.SetValue(buffer);
+                return buffer;
+            }
+
+            // Buffers are only removed at shutdown, so readers can walk the list without a lock.
+            size_t capacity = GetEventsPerThread();
+            ThreadBuffer* buffer = new ThreadBuffer();
+            buffer->mask = capacity - 1;
+            buffer->events = new Event[capacity];
+            buffer->threadId = os::Thread::CurrentThreadId();
+            buffer->writeIndex = 0;
+            buffer->firstIndex = 0;
+            buffer->owned = 1;
+            ThreadBuffer* head;
+            do
+            {
+                head = os::Atomic::ReadPointer(&m_Buffers);
+                buffer->next = head;
+            }
+            while (os::Atomic::CompareExchangePointer(&m_Buffers, buffer, head) != head);
+
+            m_CurrentThreadBuffer.SetValue(buffer);
+            return buffer;
+        }
+
+        static void AppendEvent(const Event& event, os::Thread::ThreadId threadId, std::string& output)
+        {
+            std::string name;
+            StackSampleTree::AppendFrameName(event.method, name);
+
+            output += "{\"name\":\"";
+            for (size_t i = 0; i < name.size(); i++)
+            {
+                if (name[i] == '"' || name[i] == '\\')
+                    output += '\\';
+                output += name[i];
+            }
+
+            char fields[128];
+            snprintf(fields, sizeof(fields), "\",\"ph\":\"%c\",\"ts\":%lld.%d,\"pid\":1,\"tid\":%llu}",
+                event.kind == kEventEnter ? 'B' : 'E',
+                (long long)(event.ticks / 10), (int)(event.ticks % 10), (unsigned long long)threadId);
+            output += fields;
+        }
+
+        os::FastMutex m_FilterMutex;
+        Filters* volatile m_Filters;
+        volatile int32_t m_EventsPerThread;
+
+        volatile int32_t m_Installed;
+        volatile int32_t m_Recording;
+        os::ThreadLocalValue m_CurrentThreadBuffer;
+        ThreadBuffer* volatile m_Buffers;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
+
+#endif // IL2CPP_ENABLE_PROFILER
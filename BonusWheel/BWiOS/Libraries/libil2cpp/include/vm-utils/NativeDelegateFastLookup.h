@@ -0,0 +1,106 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "il2cpp-class-internals.h"
+#include "il2cpp-object-internals.h"
+#include "gc/WriteBarrier.h"
+#include "utils/Memory.h"
+#include "utils/ReadMostlyPointerMap.h"
+#include "vm/Object.h"
+#include "vm/PlatformInvoke.h"
+#include <stddef.h>
+#include <string.h>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Lock free front for marshaling native function pointers to delegates.
+///
+/// vm::PlatformInvoke::MarshalFunctionPointerToDelegate lives in the prebuilt runtime and
+/// looks the pointer up in NativeDelegateMethodCache, which takes its FastMutex on every
+/// call, although the cache is only written the first time a pointer is marshaled.
+/// il2cpp_codegen_marshal_function_ptr_to_delegate comes here instead. The first marshal
+/// of a pointer still goes through the runtime, and the fields of the delegate it built
+/// are kept. Later marshals of the same pointer to the same delegate type allocate the
+/// delegate and copy those fields in, without locking.
+///
+/// Only delegates that hold no managed references besides themselves are kept, since the
+/// copies live in native memory the collector does not scan. The map and its entries are
+/// never freed, so a marshal that runs during or after static destruction still finds
+/// valid memory.
+    class NativeDelegateFastLookup
+    {
+    public:
+        static Il2CppDelegate* MarshalFunctionPointerToDelegate(void* functionPtr, Il2CppClass* delegateType)
+        {
+#if !IL2CPP_TINY
+            if (functionPtr != NULL)
+            {
+                const Entry* entry = GetMap().Get(functionPtr);
+                if (entry != NULL && entry->delegateType == delegateType)
+                    return CreateDelegate(entry, functionPtr);
+            }
+
+            Il2CppDelegate* delegate = vm::PlatformInvoke::MarshalFunctionPointerToDelegate(functionPtr, delegateType);
+            if (delegate != NULL)
+                Remember(functionPtr, delegateType, delegate);
+            return delegate;
+#else
+            return vm::PlatformInvoke::MarshalFunctionPointerToDelegate(functionPtr, delegateType);
+#endif
+        }
+
+    private:
+#if !IL2CPP_TINY
+        // Every field of Il2CppDelegate after the object header.
+        static const size_t kFieldsOffset = offsetof(Il2CppDelegate, method_ptr);
+        static const size_t kFieldsSize = sizeof(Il2CppDelegate) - kFieldsOffset;
+
+        struct Entry
+        {
+            Il2CppClass* delegateType;
+            bool targetIsDelegate;
+            uint8_t fields[kFieldsSize];
+        };
+
+        typedef ReadMostlyPointerMap<void*, const Entry*> Map;
+
+        static Map& GetMap()
+        {
+            static Map* s_Map = new Map();
+            return *s_Map;
+        }
+
+        static Il2CppDelegate* CreateDelegate(const Entry* entry, void* functionPtr)
+        {
+            Il2CppDelegate* delegate = (Il2CppDelegate*)vm::Object::New(entry->delegateType);
+            memcpy((uint8_t*)delegate + kFieldsOffset, entry->fields, kFieldsSize);
+            if (entry->targetIsDelegate)
+                gc::WriteBarrier::GenericStore(&delegate->target, delegate);
+
+            IL2CPP_ASSERT(delegate->delegate_trampoline == functionPtr);
+            return delegate;
+        }
+
+        static void Remember(void* functionPtr, Il2CppClass* delegateType, const Il2CppDelegate* delegate)
+        {
+            if (delegate->target != NULL && delegate->target != (Il2CppObject*)delegate)
+                return;
+            if (delegate->method_info != NULL || delegate->original_method_info != NULL || delegate->data != NULL)
+                return;
+
+            Entry* entry = (Entry*)IL2CPP_MALLOC(sizeof(Entry));
+            entry->delegateType = delegateType;
+            entry->targetIsDelegate = delegate->target != NULL;
+            memcpy(entry->fields, (const uint8_t*)delegate + kFieldsOffset, kFieldsSize);
+            memset(entry->fields + offsetof(Il2CppDelegate, target) - kFieldsOffset, 0, sizeof(delegate->target));
+
+            // A pointer marshaled to another delegate type replaces the entry. The old entry
+            // may still be read by a concurrent lookup, so it is not freed.
+            GetMap().Add(functionPtr, entry);
+        }
+#endif
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,432 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "il2cpp-api-types.h"
+#include "il2cpp-vm-support.h"
+#include "os/Atomic.h"
+#include "os/Mutex.h"
+#include "os/Thread.h"
+#include "utils/FileUtils.h"
+#include "utils/NonCopyable.h"
+#include "vm/Profiler.h"
+#include "vm-utils/NativeSymbol.h"
+#include "vm-utils/StackSampleTree.h"
+#include <string.h>
+#include <string>
+#include <vector>
+
+// Sampling interrupts a thread with a signal and walks its frame pointer chain from the
+// interrupted registers, so it needs POSIX signals, a known ucontext layout and frame
+// pointers, and it needs the native symbol map to turn return addresses into methods.
+#if IL2CPP_ENABLE_NATIVE_STACKTRACES && (IL2CPP_TARGET_DARWIN || IL2CPP_TARGET_LINUX || IL2CPP_TARGET_ANDROID) && (defined(__aarch64__) || defined(__x86_64__))
+#define IL2CPP_SAMPLING_PROFILER_SUPPORTED 1
+#else
+#define IL2CPP_SAMPLING_PROFILER_SUPPORTED 0
+#endif
+
+#if IL2CPP_SAMPLING_PROFILER_SUPPORTED
+#include <pthread.h>
+#include <signal.h>
+#include <ucontext.h>
+#endif
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Low overhead sampling profiler for managed code, for release players.
+///
+/// A background thread ticks at the requested rate and on every tick interrupts each
+/// registered thread with SIGPROF. The handler runs on the interrupted thread: it reads
+/// the program counter and frame pointer from the signal context and copies the return
+/// addresses along the frame pointer chain into the thread's slot, which only takes loads
+/// and stores, so it is safe wherever the thread was stopped. The sampler thread then
+/// maps the addresses to methods through NativeSymbol, drops the native frames and folds
+/// the stack into a StackSampleTree. Nothing runs on managed threads between ticks, and
+/// generated code needs no profiler hooks.
+///
+/// Start registers the calling thread. Threads attached to the VM while the profiler is
+/// installed register and unregister themselves through the profiler thread callbacks,
+/// which il2cpp raises on the attaching and detaching thread. Any other thread calls
+/// RegisterCurrentThread, and must call UnregisterCurrentThread before it exits.
+///
+/// Supported on Darwin (iOS, macOS), Linux and Android, on arm64 and x86-64, in builds with
+/// native stack traces; elsewhere Start returns false. arm64 always keeps frame pointers;
+/// on x86-64 the player must be built without -fomit-frame-pointer, or stacks stop at the
+/// first function that omits them.
+///
+/// Results are exported in collapsed-stack format, which flamegraph.pl and speedscope
+/// read directly.
+    class SamplingProfiler : public il2cpp::utils::NonCopyable
+    {
+    public:
+        static const uint32_t kDefaultSamplesPerSecond = 1000;
+        static const uint32_t kMaxThreads = 64;
+        static const uint32_t kMaxFrames = 128;
+
+        static SamplingProfiler& Get()
+        {
+            static SamplingProfiler s_Profiler;
+            return s_Profiler;
+        }
+
+        /// Starts sampling. samplesPerSecond must not be 0. The rate is rounded to a whole
+        /// number of milliseconds, the granularity of os::Thread::Sleep, so rates above
+        /// 1000 sample once per millisecond.
+        bool Start(uint32_t samplesPerSecond = kDefaultSamplesPerSecond)
+        {
+            IL2CPP_ASSERT(samplesPerSecond != 0);
+#if IL2CPP_SAMPLING_PROFILER_SUPPORTED
+            if (samplesPerSecond == 0 || os::Atomic::CompareExchange(&m_Running, 1, 0) != 0)
+                return false;
+
+            InstallSignalHandler();
+#if IL2CPP_ENABLE_PROFILER
+            InstallThreadCallbacks();
+#endif
+            RegisterCurrentThread();
+
+            m_IntervalMilliseconds = samplesPerSecond >= 1000 ? 1 : 1000 / samplesPerSecond;
+            m_SamplerThread = new os::Thread();
+            m_SamplerThread->SetName("il2cpp sampling profiler");
+            if (m_SamplerThread->Run(SamplerThreadMain, this) != os::kErrorCodeSuccess)
+            {
+                delete m_SamplerThread;
+                m_SamplerThread = NULL;
+                os::Atomic::Exchange(&m_Running, 0);
+                return false;
+            }
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        void Stop()
+        {
+            if (os::Atomic::CompareExchange(&m_Running, 0, 1) != 1)
+                return;
+
+            m_SamplerThread->Join();
+            delete m_SamplerThread;
+            m_SamplerThread = NULL;
+        }
+
+        bool IsRunning()
+        {
+            return os::Atomic::CompareExchange(&m_Running, 0, 0) != 0;
+        }
+
+        /// Adds the calling thread to the sampled threads. Returns false when every slot
+        /// is taken or sampling is not supported.
+        bool RegisterCurrentThread()
+        {
+#if IL2CPP_SAMPLING_PROFILER_SUPPORTED
+            pthread_t self = pthread_self();
+            uintptr_t stackLow, stackHigh;
+            GetCurrentStackBounds(&stackLow, &stackHigh);
+
+            for (uint32_t i = 0; i < kMaxThreads; i++)
+            {
+                ThreadSlot& slot = m_Threads[i];
+                if (os::Atomic::CompareExchange(&slot.state, kSlotClaiming, kSlotFree) != kSlotFree)
+                    continue;
+
+                slot.thread = self;
+                slot.stackLow = stackLow;
+                slot.stackHigh = stackHigh;
+                os::Atomic::Exchange(&slot.state, kSlotIdle);
+                return true;
+            }
+#endif
+            return false;
+        }
+
+        /// Stops sampling the calling thread; waits for a sample of it in progress to end.
+        void UnregisterCurrentThread()
+        {
+#if IL2CPP_SAMPLING_PROFILER_SUPPORTED
+            pthread_t self = pthread_self();
+            for (uint32_t i = 0; i < kMaxThreads; i++)
+            {
+                ThreadSlot& slot = m_Threads[i];
+                if (os::Atomic::CompareExchange(&slot.state, 0, 0) == kSlotFree || !pthread_equal(slot.thread, self))
+                    continue;
+
+                // Waits out a sample of this thread in progress. A signal that arrives after
+                // the slot is freed finds it no longer requested and is ignored.
+                while (os::Atomic::CompareExchange(&slot.state, kSlotFree, kSlotIdle) != kSlotIdle)
+                    os::Thread::YieldInternal();
+                return;
+            }
+#endif
+        }
+
+        uint64_t GetSampleCount()
+        {
+            os::FastAutoLock lock(&m_TreeMutex);
+            return m_SampleCount;
+        }
+
+        void Reset()
+        {
+            os::FastAutoLock lock(&m_TreeMutex);
+            m_Tree.Clear();
+            m_SampleCount = 0;
+        }
+
+        std::string GetCollapsedStacks()
+        {
+            std::string output;
+            os::FastAutoLock lock(&m_TreeMutex);
+            m_Tree.WriteCollapsed(output);
+            return output;
+        }
+
+        /// Can be called while sampling is running; the file reflects the samples taken so far.
+        bool WriteCollapsedStacks(const std::string& path)
+        {
+            return FileUtils::WriteAll(path, GetCollapsedStacks());
+        }
+
+    private:
+        // Slot states. Only the sampler moves idle -> requested and ready -> idle; only the
+        // signal handler moves requested -> writing -> ready.
+        enum
+        {
+            kSlotFree = 0,
+            kSlotClaiming = 1,
+            kSlotIdle = 2,
+            kSlotRequested = 3,
+            kSlotWriting = 4,
+            kSlotReady = 5
+        };
+
+        // How long the sampler waits for a signalled thread before skipping it this tick.
+        static const uint32_t kSampleTimeoutSpins = 1000;
+
+        struct ThreadSlot
+        {
+            volatile int32_t state;
+#if IL2CPP_SAMPLING_PROFILER_SUPPORTED
+            pthread_t thread;
+#endif
+            uintptr_t stackLow;
+            uintptr_t stackHigh;
+            uint32_t frameCount;
+            void* frames[kMaxFrames];
+        };
+
+        SamplingProfiler()
+            : m_SamplerThread(NULL), m_Running(0), m_IntervalMilliseconds(1), m_SampleCount(0)
+#if IL2CPP_ENABLE_PROFILER
+            , m_ThreadCallbacksInstalled(false)
+#endif
+        {
+            for (uint32_t i = 0; i < kMaxThreads; i++)
+                m_Threads[i].state = kSlotFree;
+        }
+
+        ~SamplingProfiler()
+        {
+            Stop();
+        }
+
+#if IL2CPP_SAMPLING_PROFILER_SUPPORTED
+        static void SamplerThreadMain(void* arg)
+        {
+            SamplingProfiler* profiler = static_cast<SamplingProfiler*>(arg);
+            while (profiler->IsRunning())
+            {
+                for (uint32_t i = 0; i < kMaxThreads; i++)
+                    profiler->SampleThread(profiler->m_Threads[i]);
+                os::Thread::Sleep(profiler->m_IntervalMilliseconds);
+            }
+        }
+
+        void SampleThread(ThreadSlot& slot)
+        {
+            if (os::Atomic::CompareExchange(&slot.state, kSlotRequested, kSlotIdle) != kSlotIdle)
+                return;
+
+            if (pthread_kill(slot.thread, SIGPROF) != 0)
+            {
+                os::Atomic::Exchange(&slot.state, kSlotIdle);
+                return;
+            }
+
+            for (uint32_t spin = 0; os::Atomic::CompareExchange(&slot.state, 0, 0) != kSlotReady; spin++)
+            {
+                // Give up on a thread that has not started handling the signal yet; once the
+                // handler has claimed the slot it finishes quickly, so wait for it.
+                if (spin >= kSampleTimeoutSpins && os::Atomic::CompareExchange(&slot.state, kSlotIdle, kSlotRequested) == kSlotRequested)
+                    return;
+                os::Thread::YieldInternal();
+            }
+
+            AddSample(slot.frames, slot.frameCount);
+            os::Atomic::Exchange(&slot.state, kSlotIdle);
+        }
+
+        void AddSample(void* const* addresses, uint32_t count)
+        {
+            os::FastAutoLock lock(&m_TreeMutex);
+            m_Frames.clear();
+            for (uint32_t i = 0; i < count; i++)
+            {
+                // Return addresses point past the call; step back into the calling function.
+                uintptr_t address = (uintptr_t)addresses[i] - (i == 0 ? 0 : 1);
+                const MethodInfo* method = NativeSymbol::GetMethodFromNativeSymbol((Il2CppMethodPointer)address);
+                if (method != NULL)
+                    m_Frames.push_back(method);
+            }
+
+            // Threads interrupted with no managed frames are not interesting.
+            if (m_Frames.empty())
+                return;
+
+            m_Tree.AddSample(&m_Frames[0], m_Frames.size(), 1);
+            m_SampleCount++;
+        }
+
+        static void InstallSignalHandler()
+        {
+            // Never uninstalled: a SIGPROF arriving after Stop would otherwise terminate the
+            // process. The handler ignores signals for slots that did not request a sample.
+            static bool s_Installed = false;
+            if (s_Installed)
+                return;
+            s_Installed = true;
+
+            struct sigaction action;
+            memset(&action, 0, sizeof(action));
+            action.sa_sigaction = OnSignal;
+            action.sa_flags = SA_SIGINFO | SA_RESTART;
+            sigemptyset(&action.sa_mask);
+            sigaction(SIGPROF, &action, NULL);
+        }
+
+        static void OnSignal(int, siginfo_t*, void* context)
+        {
+            SamplingProfiler& profiler = Get();
+            pthread_t self = pthread_self();
+            for (uint32_t i = 0; i < kMaxThreads; i++)
+            {
+                ThreadSlot& slot = profiler.m_Threads[i];
+                if (slot.state != kSlotRequested || !pthread_equal(slot.thread, self))
+                    continue;
+                if (os::Atomic::CompareExchange(&slot.state, kSlotWriting, kSlotRequested) != kSlotRequested)
+                    return;
+
+                slot.frameCount = WalkInterruptedStack(static_cast<ucontext_t*>(context), slot.stackLow, slot.stackHigh, slot.frames);
+                os::Atomic::Exchange(&slot.state, kSlotReady);
+                return;
+            }
+        }
+
+        // Async signal safe: reads registers from the context and words on the thread's own
+        // stack, and never follows a frame pointer outside [stackLow, stackHigh).
+        static uint32_t WalkInterruptedStack(ucontext_t* context, uintptr_t stackLow, uintptr_t stackHigh, void** frames)
+        {
+            uintptr_t pc, fp;
+#if IL2CPP_TARGET_DARWIN && defined(__aarch64__)
+            pc = (uintptr_t)arm_thread_state64_get_pc(context->uc_mcontext->__ss);
+            fp = (uintptr_t)arm_thread_state64_get_fp(context->uc_mcontext->__ss);
+#elif IL2CPP_TARGET_DARWIN
+            pc = (uintptr_t)context->uc_mcontext->__ss.__rip;
+            fp = (uintptr_t)context->uc_mcontext->__ss.__rbp;
+#elif defined(__aarch64__)
+            pc = (uintptr_t)context->uc_mcontext.pc;
+            fp = (uintptr_t)context->uc_mcontext.regs[29];
+#else
+            pc = (uintptr_t)context->uc_mcontext.gregs[REG_RIP];
+            fp = (uintptr_t)context->uc_mcontext.gregs[REG_RBP];
+#endif
+
+            uint32_t count = 0;
+            frames[count++] = (void*)pc;
+            while (count < kMaxFrames && fp >= stackLow && fp + 2 * sizeof(uintptr_t) <= stackHigh && (fp & (sizeof(uintptr_t) - 1)) == 0)
+            {
+                const uintptr_t* frame = reinterpret_cast<const uintptr_t*>(fp);
+                uintptr_t returnAddress = frame[1];
+                if (returnAddress == 0)
+                    break;
+
+                frames[count++] = (void*)returnAddress;
+
+                // Frames live at increasing addresses towards the stack base.
+                if (frame[0] <= fp)
+                    break;
+                fp = frame[0];
+            }
+            return count;
+        }
+
+        static void GetCurrentStackBounds(uintptr_t* low, uintptr_t* high)
+        {
+#if IL2CPP_TARGET_DARWIN
+            pthread_t self = pthread_self();
+            *high = (uintptr_t)pthread_get_stackaddr_np(self);
+            *low = *high - pthread_get_stacksize_np(self);
+#else
+            void* address = NULL;
+            size_t size = 0;
+            pthread_attr_t attributes;
+            if (pthread_getattr_np(pthread_self(), &attributes) == 0)
+            {
+                pthread_attr_getstack(&attributes, &address, &size);
+                pthread_attr_destroy(&attributes);
+            }
+            *low = (uintptr_t)address;
+            *high = (uintptr_t)address + size;
+#endif
+        }
+
+#if IL2CPP_ENABLE_PROFILER
+        // vm::Profiler has no way to uninstall a profiler, and SetEvents only updates the most
+        // recently installed one, so the callbacks are installed once, with their events set
+        // right away, and stay in place.
+        void InstallThreadCallbacks()
+        {
+            if (m_ThreadCallbacksInstalled)
+                return;
+
+            m_ThreadCallbacksInstalled = true;
+            vm::Profiler::Install(reinterpret_cast<Il2CppProfiler*>(this), OnShutdown);
+            vm::Profiler::InstallThread(OnThreadStart, OnThreadEnd);
+            vm::Profiler::SetEvents(IL2CPP_PROFILE_THREADS);
+        }
+
+        static void OnShutdown(Il2CppProfiler*)
+        {
+        }
+
+        static void OnThreadStart(Il2CppProfiler* profiler, unsigned long)
+        {
+            reinterpret_cast<SamplingProfiler*>(profiler)->RegisterCurrentThread();
+        }
+
+        static void OnThreadEnd(Il2CppProfiler* profiler, unsigned long)
+        {
+            reinterpret_cast<SamplingProfiler*>(profiler)->UnregisterCurrentThread();
+        }
+
+#endif
+#endif
+
+        os::Thread* m_SamplerThread;
+        volatile int32_t m_Running;
+        uint32_t m_IntervalMilliseconds;
+        ThreadSlot m_Threads[kMaxThreads];
+
+        os::FastMutex m_TreeMutex;
+        StackSampleTree m_Tree;
+        uint64_t m_SampleCount;
+        std::vector<const MethodInfo*> m_Frames;
+
+#if IL2CPP_ENABLE_PROFILER
+        bool m_ThreadCallbacksInstalled;
+#endif
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "il2cpp-config.h"
+#include "il2cpp-class-internals.h"
+#include "utils/NonCopyable.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+namespace il2cpp
+{
+namespace utils
+{
+/// Call tree of managed stacks with a weight accumulated per node.
+///
+/// Stacks are added innermost frame first, which is the order in which
+/// vm::StackTrace::WalkFrameStack and WalkThreadFrameStack report them. The weight
+/// is whatever the caller is measuring (a sample count, a number of bytes, ...).
+///
+/// Not thread safe; callers serialize access.
+    class StackSampleTree : public il2cpp::utils::NonCopyable
+    {
+    public:
+        StackSampleTree()
+        {
+            m_Root.method = NULL;
+            m_Root.selfWeight = 0;
+            m_Root.totalWeight = 0;
+        }
+
+        ~StackSampleTree()
+        {
+            Clear();
+        }
+
+        void AddSample(const MethodInfo* const* innermostFirstFrames, size_t frameCount, uint64_t weight)
+        {
+            Node* node = &m_Root;
+            node->totalWeight += weight;
+            for (size_t i = frameCount; i > 0; i--)
+            {
+                node = node->GetOrAddChild(innermostFirstFrames[i - 1]);
+                node->totalWeight += weight;
+            }
+            node->selfWeight += weight;
+        }
+
+        uint64_t GetTotalWeight() const
+        {
+            return m_Root.totalWeight;
+        }
+
+        void Clear()
+        {
+            for (size_t i = 0; i < m_Root.children.size(); i++)
+                delete m_Root.children[i];
+            m_Root.children.clear();
+            m_Root.selfWeight = 0;
+            m_Root.totalWeight = 0;
+        }
+
+        /// Appends the tree in the collapsed-stack format understood by flamegraph.pl and
+        /// speedscope: one "Outer;...;Inner weight" line per distinct stack.
+        void WriteCollapsed(std::string& output) const
+        {
+            std::string prefix;
+            for (size_t i = 0; i < m_Root.children.size(); i++)
+                WriteCollapsed(*m_Root.children[i], prefix, output);
+        }
+
+        /// Formats a frame as Namespace.Class:Method with the characters that are significant
+        /// to the collapsed format replaced. Frames without a method are written as <unknown>.
+        static void AppendFrameName(const MethodInfo* method, std::string& output)
+        {
+            if (method == NULL)
+            {
+                output += "<unknown>";
+                return;
+            }
+
+            size_t start = output.size();
+            if (method->klass != NULL)
+            {
+                if (method->klass->namespaze != NULL && method->klass->namespaze[0] != '\0')
+                {
+                    output += method->klass->namespaze;
+                    output += '.';
+                }
+                output += method->klass->name;
+                output += ':';
+            }
+            output += method->name;
+
+            for (size_t i = start; i < output.size(); i++)
+            {
+                if (output[i] == ';' || output[i] == ' ')
+                    output[i] = '_';
+            }
+        }
+
+    private:
+        struct Node
+        {
+            const MethodInfo* method;
+            uint64_t selfWeight;
+            uint64_t totalWeight;
+            std::vector<Node*> children;
+
+            ~Node()
+            {
+                for (size_t i = 0; i < children.size(); i++)
+                    delete children[i];
+            }
+
+            // Fan-out per frame is small in practice, so a linear scan beats a map here.
+            Node* GetOrAddChild(const MethodInfo* childMethod)
+            {
+                for (size_t i = 0; i < children.size(); i++)
+                {
+                    if (children[i]->method == childMethod)
+                        return children[i];
+                }
+
+                Node* child = new Node();
+                child->method = childMethod;
+                child->selfWeight = 0;
+                child->totalWeight = 0;
+                children.push_back(child);
+                return child;
+            }
+        };
+
+        static void WriteCollapsed(const Node& node, std::string& prefix, std::string& output)
+        {
+            size_t prefixLength = prefix.size();
+            if (prefixLength != 0)
+                prefix += ';';
+            AppendFrameName(node.method, prefix);
+
+            if (node.selfWeight != 0)
+            {
+                char weight[24];
+                snprintf(weight, sizeof(weight), " %llu\n", (unsigned long long)node.selfWeight);
+                output += prefix;
+                output += weight;
+            }
+
+            for (size_t i = 0; i < node.children.size(); i++)
+                WriteCollapsed(*node.children[i], prefix, output);
+
+            prefix.resize(prefixLength);
+        }
+
+        Node m_Root;
+    };
+} /* namespace utils */
+} /* namespace il2cpp */
@@ -0,0 +1,106 @@
+#pragma once
+
+//This file should not include anything from VM. This is included by both libil2cpp and the codegen headers
+#include "il2cpp-config.h"
+#include "il2cpp-class-internals.h"
+#include "il2cpp-object-internals.h"
+#include "os/Unity/UnityPlatformConfigure.h"
+#include "os/Unity/ExtendedAtomicOps.h"
+
+namespace il2cpp
+{
+namespace vm
+{
+    // Constant time answers for casts that HasParentUnsafe cannot handle: interfaces,
+    // variant generic interfaces and delegates, arrays. The result of such a cast only
+    // depends on the object's class and the target class, so it is computed once by the
+    // full IsAssignableFrom path and remembered in a direct mapped table; after that a
+    // cast is a hash, a few loads and two compares.
+    //
+    // Entries are guarded by a per-entry sequence number so that concurrent fills never
+    // produce a torn (class, target, result) triple: a writer moves the sequence to an odd
+    // value while it writes, and readers discard entries whose sequence was odd or changed
+    // while they read. A collision simply evicts the older entry.
+    //
+    // COM and Windows Runtime objects are never cached, as their casts can depend on the
+    // instance (QueryInterface).
+    class CastCache
+    {
+    public:
+        enum Result
+        {
+            kMiss,
+            kAssignable,
+            kNotAssignable
+        };
+
+        static IL2CPP_FORCE_INLINE Result Lookup(const Il2CppClass* klass, const Il2CppClass* target)
+        {
+            const Entry& entry = GetEntries()[Hash(klass, target)];
+
+            atomic_word sequence = il2cpp::os::atomic_load_explicit(&entry.sequence, il2cpp::os::memory_order_acquire);
+            if (sequence & 1)
+                return kMiss;
+
+            const Il2CppClass* cachedClass = entry.klass;
+            const Il2CppClass* cachedTarget = entry.target;
+            atomic_word assignable = entry.assignable;
+
+            il2cpp::os::atomic_thread_fence(il2cpp::os::memory_order_acquire);
+            if (il2cpp::os::atomic_load_explicit(&entry.sequence, il2cpp::os::memory_order_relaxed) != sequence)
+                return kMiss;
+
+            if (cachedClass != klass || cachedTarget != target)
+                return kMiss;
+
+            return assignable ? kAssignable : kNotAssignable;
+        }
+
+        static inline void Store(const Il2CppClass* klass, const Il2CppClass* target, bool assignable)
+        {
+            if (klass->is_import_or_windows_runtime)
+                return;
+
+            Entry& entry = GetEntries()[Hash(klass, target)];
+
+            // If another thread is filling this entry, let it win rather than wait.
+            atomic_word sequence = il2cpp::os::atomic_load_explicit(&entry.sequence, il2cpp::os::memory_order_relaxed);
+            if ((sequence & 1) || !il2cpp::os::atomic_compare_exchange_strong_explicit(&entry.sequence, &sequence, sequence + 1, il2cpp::os::memory_order_acquire, il2cpp::os::memory_order_relaxed))
+                return;
+
+            // The odd sequence must be visible before any of the payload stores below.
+            il2cpp::os::atomic_thread_fence(il2cpp::os::memory_order_release);
+
+            entry.klass = klass;
+            entry.target = target;
+            entry.assignable = assignable ? 1 : 0;
+
+            il2cpp::os::atomic_store_explicit(&entry.sequence, sequence + 2, il2cpp::os::memory_order_release);
+        }
+
+    private:
+        static const size_t kEntryCount = 2048;
+
+        struct Entry
+        {
+            volatile atomic_word sequence;
+            const Il2CppClass* volatile klass;
+            const Il2CppClass* volatile target;
+            volatile atomic_word assignable;
+        };
+
+        static IL2CPP_FORCE_INLINE size_t Hash(const Il2CppClass* klass, const Il2CppClass* target)
+        {
+            size_t hash = ((uintptr_t)klass >> 4) ^ (((uintptr_t)target >> 4) * 0x9E3779B1u);
+            return (hash ^ (hash >> 11)) & (kEntryCount - 1);
+        }
+
+        static IL2CPP_FORCE_INLINE Entry* GetEntries()
+        {
+            // Zero initialized static storage, so there is no initialization guard on this path.
+            static Entry s_Entries[kEntryCount];
+            return s_Entries;
+        }
+    };
+}
+}
@@ -0,0 +1,190 @@
+#import <XCTest/XCTest.h>
+
+#include "vm/CastCache.h"
+#include <thread>
+#include <vector>
+
+using il2cpp::vm::CastCache;
+
+namespace
+{
+    const size_t kClassCount = 64;
+    const size_t kInterfaceCount = 8;
+    const int kRounds = 20000;
+
+    // The cache only compares class addresses, so the classes here are zeroed structs
+    // owned by the test; each test uses its own so that entries do not carry over.
+    struct FakeClasses
+    {
+        Il2CppClass classes[kClassCount];
+        Il2CppClass interfaces[kInterfaceCount];
+        Il2CppClass* interfacePointers[kInterfaceCount];
+
+        FakeClasses()
+        {
+            memset(classes, 0, sizeof(classes));
+            memset(interfaces, 0, sizeof(interfaces));
+            for (size_t i = 0; i < kInterfaceCount; i++)
+                interfacePointers[i] = &interfaces[i];
+
+            // Even classes implement every interface, odd classes none.
+            for (size_t i = 0; i < kClassCount; i += 2)
+            {
+                classes[i].implementedInterfaces = interfacePointers;
+                classes[i].interfaces_count = kInterfaceCount;
+            }
+        }
+    };
+
+    // Stand-in for the IsAssignableFrom walk IsInst takes for an interface target: an out of
+    // line call that scans the class's interfaces and then its parents'.
+    __attribute__((noinline)) bool ImplementsInterfaceStandIn(const Il2CppClass* klass, const Il2CppClass* target)
+    {
+        for (; klass != NULL; klass = klass->parent)
+        {
+            for (uint16_t i = 0; i < klass->interfaces_count; i++)
+            {
+                if (klass->implementedInterfaces[i] == target)
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    bool ExpectedForPair(size_t classIndex, size_t targetIndex)
+    {
+        return (classIndex + targetIndex) % 3 == 0;
+    }
+}
+
+@interface CastCacheTests : XCTestCase
+
+@end
+
+@implementation CastCacheTests
+
+- (void)testLookupReturnsStoredResults
+{
+    FakeClasses* fake = new FakeClasses();
+    Il2CppClass* klass = &fake->classes[0];
+    Il2CppClass* target = &fake->interfaces[0];
+    Il2CppClass* other = &fake->interfaces[1];
+
+    XCTAssertEqual(CastCache::Lookup(klass, target), CastCache::kMiss);
+
+    CastCache::Store(klass, target, true);
+    CastCache::Store(klass, other, false);
+    XCTAssertEqual(CastCache::Lookup(klass, target), CastCache::kAssignable);
+    XCTAssertEqual(CastCache::Lookup(klass, other), CastCache::kNotAssignable);
+
+    // The pair is ordered: the reverse cast was never stored.
+    XCTAssertEqual(CastCache::Lookup(target, klass), CastCache::kMiss);
+    delete fake;
+}
+
+- (void)testWindowsRuntimeClassesAreNotCached
+{
+    FakeClasses* fake = new FakeClasses();
+    Il2CppClass* klass = &fake->classes[1];
+    klass->is_import_or_windows_runtime = 1;
+
+    CastCache::Store(klass, &fake->interfaces[0], true);
+    XCTAssertEqual(CastCache::Lookup(klass, &fake->interfaces[0]), CastCache::kMiss);
+    delete fake;
+}
+
+- (void)testCollisionsEvictWithoutWrongAnswers
+{
+    FakeClasses* fake = new FakeClasses();
+    Il2CppClass* klass = &fake->classes[0];
+    Il2CppClass* target = &fake->interfaces[0];
+    CastCache::Store(klass, target, true);
+
+    // 4096 other classes against the same target overfill the 2048 entries, so the first
+    // pair is evicted at some point, but it must never read back as not assignable.
+    std::vector<Il2CppClass> others(4096);
+    memset(&others[0], 0, others.size() * sizeof(Il2CppClass));
+    bool evicted = false;
+    for (size_t i = 0; i < others.size(); i++)
+    {
+        CastCache::Store(&others[i], target, false);
+        CastCache::Result result = CastCache::Lookup(klass, target);
+        XCTAssertNotEqual(result, CastCache::kNotAssignable);
+        evicted |= result == CastCache::kMiss;
+    }
+    XCTAssertTrue(evicted);
+    delete fake;
+}
+
+- (void)testConcurrentFillsNeverReturnTornEntries
+{
+    FakeClasses* fake = new FakeClasses();
+    const size_t kThreadCount = 4;
+    volatile int wrongAnswers = 0;
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreadCount; t++)
+    {
+        threads.push_back(std::thread([fake, t, &wrongAnswers] {
+            for (int round = 0; round < 200; round++)
+            {
+                for (size_t i = 0; i < kClassCount; i++)
+                {
+                    size_t classIndex = (i + t * 7) % kClassCount;
+                    for (size_t j = 0; j < kInterfaceCount; j++)
+                    {
+                        bool expected = ExpectedForPair(classIndex, j);
+                        CastCache::Result result = CastCache::Lookup(&fake->classes[classIndex], &fake->interfaces[j]);
+                        if (result == CastCache::kMiss)
+                            CastCache::Store(&fake->classes[classIndex], &fake->interfaces[j], expected);
+                        else if ((result == CastCache::kAssignable) != expected)
+                            __sync_fetch_and_add(&wrongAnswers, 1);
+                    }
+                }
+            }
+        }));
+    }
+    for (size_t t = 0; t < kThreadCount; t++)
+        threads[t].join();
+
+    XCTAssertEqual(wrongAnswers, 0);
+    delete fake;
+}
+
+- (void)testPerformanceOfCachedInterfaceCasts
+{
+    FakeClasses* fake = new FakeClasses();
+    Il2CppClass* target = &fake->interfaces[kInterfaceCount - 1];
+    for (size_t i = 0; i < kClassCount; i++)
+        CastCache::Store(&fake->classes[i], target, ImplementsInterfaceStandIn(&fake->classes[i], target));
+
+    __block size_t assignableCount = 0;
+    [self measureBlock:^{
+        for (int round = 0; round < kRounds; round++)
+        {
+            for (size_t i = 0; i < kClassCount; i++)
+                assignableCount += CastCache::Lookup(&fake->classes[i], target) == CastCache::kAssignable;
+        }
+    }];
+    XCTAssertTrue(assignableCount > 0);
+    delete fake;
+}
+
+- (void)testPerformanceOfUncachedInterfaceCasts
+{
+    FakeClasses* fake = new FakeClasses();
+    Il2CppClass* target = &fake->interfaces[kInterfaceCount - 1];
+
+    __block size_t assignableCount = 0;
+    [self measureBlock:^{
+        for (int round = 0; round < kRounds; round++)
+        {
+            for (size_t i = 0; i < kClassCount; i++)
+                assignableCount += ImplementsInterfaceStandIn(&fake->classes[i], target);
+        }
+    }];
+    XCTAssertTrue(assignableCount > 0);
+    delete fake;
+}
+
+@end
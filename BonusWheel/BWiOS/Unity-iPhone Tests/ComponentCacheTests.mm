@@ -0,0 +1,112 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/ComponentCache.h"
+
+using il2cpp::utils::ComponentCache;
+
+namespace
+{
+    // Distinct addresses standing in for GameObjects, component types and components.
+    int s_GameObjects[2];
+    int s_Types[ComponentCache::kWays + 1];
+    int s_Components[ComponentCache::kWays + 1];
+}
+
+@interface ComponentCacheTests : XCTestCase
+
+@end
+
+@implementation ComponentCacheTests
+
+- (void)testStoredResultsAreReturnedPerGameObject
+{
+    ComponentCache cache;
+    void* component = NULL;
+    XCTAssertFalse(cache.TryGet(&s_GameObjects[0], &s_Types[0], &component));
+
+    cache.Store(&s_GameObjects[0], &s_Types[0], &s_Components[0]);
+    XCTAssertTrue(cache.TryGet(&s_GameObjects[0], &s_Types[0], &component));
+    XCTAssertTrue(component == &s_Components[0]);
+
+    XCTAssertFalse(cache.TryGet(&s_GameObjects[1], &s_Types[0], &component));
+    XCTAssertFalse(cache.TryGet(&s_GameObjects[0], &s_Types[1], &component));
+    XCTAssertEqual(cache.GetHitCount(), 1u);
+    XCTAssertEqual(cache.GetMissCount(), 3u);
+}
+
+- (void)testMissingComponentIsCachedAsNull
+{
+    ComponentCache cache;
+    cache.Store(&s_GameObjects[0], &s_Types[0], NULL);
+
+    void* component = &s_Components[0];
+    XCTAssertTrue(cache.TryGet(&s_GameObjects[0], &s_Types[0], &component));
+    XCTAssertTrue(component == NULL);
+}
+
+- (void)testComponentChangesInvalidateEveryWay
+{
+    ComponentCache cache;
+    cache.Store(&s_GameObjects[0], &s_Types[0], &s_Components[0]);
+    cache.Store(&s_GameObjects[0], &s_Types[1], NULL);
+    cache.Store(&s_GameObjects[1], &s_Types[0], &s_Components[1]);
+
+    cache.OnComponentsChanged(&s_GameObjects[0]);
+
+    void* component;
+    XCTAssertFalse(cache.TryGet(&s_GameObjects[0], &s_Types[0], &component));
+    XCTAssertFalse(cache.TryGet(&s_GameObjects[0], &s_Types[1], &component));
+    XCTAssertTrue(cache.TryGet(&s_GameObjects[1], &s_Types[0], &component));
+
+    // Stale ways are reused for fresh results.
+    cache.Store(&s_GameObjects[0], &s_Types[1], &s_Components[1]);
+    XCTAssertTrue(cache.TryGet(&s_GameObjects[0], &s_Types[1], &component));
+    XCTAssertTrue(component == &s_Components[1]);
+}
+
+- (void)testStoringAgainReplacesTheResult
+{
+    ComponentCache cache;
+    cache.Store(&s_GameObjects[0], &s_Types[0], NULL);
+    cache.Store(&s_GameObjects[0], &s_Types[0], &s_Components[0]);
+
+    void* component;
+    XCTAssertTrue(cache.TryGet(&s_GameObjects[0], &s_Types[0], &component));
+    XCTAssertTrue(component == &s_Components[0]);
+}
+
+- (void)testFullEntryEvictsRoundRobin
+{
+    ComponentCache cache;
+    for (uint32_t i = 0; i <= ComponentCache::kWays; i++)
+        cache.Store(&s_GameObjects[0], &s_Types[i], &s_Components[i]);
+
+    // The first type made room for the last one; the others are still there.
+    void* component;
+    XCTAssertFalse(cache.TryGet(&s_GameObjects[0], &s_Types[0], &component));
+    for (uint32_t i = 1; i <= ComponentCache::kWays; i++)
+    {
+        XCTAssertTrue(cache.TryGet(&s_GameObjects[0], &s_Types[i], &component));
+        XCTAssertTrue(component == &s_Components[i]);
+    }
+}
+
+- (void)testDestroyedGameObjectStartsEmptyWhenReused
+{
+    ComponentCache cache;
+    cache.Store(&s_GameObjects[0], &s_Types[0], &s_Components[0]);
+    cache.OnGameObjectDestroyed(&s_GameObjects[0]);
+
+    void* component;
+    XCTAssertFalse(cache.TryGet(&s_GameObjects[0], &s_Types[0], &component));
+
+    // A new GameObject at another address takes over the freed entry with nothing in it.
+    cache.Store(&s_GameObjects[1], &s_Types[1], &s_Components[1]);
+    XCTAssertFalse(cache.TryGet(&s_GameObjects[1], &s_Types[0], &component));
+    XCTAssertTrue(cache.TryGet(&s_GameObjects[1], &s_Types[1], &component));
+
+    cache.Clear();
+    XCTAssertFalse(cache.TryGet(&s_GameObjects[1], &s_Types[1], &component));
+}
+
+@end
@@ -0,0 +1,133 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/CoroutineScheduler.h"
+#include <map>
+
+using il2cpp::utils::CoroutineScheduler;
+
+static bool BatchContains(const std::vector<void*>& batch, void* coroutine)
+{
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+        if (batch[i] == coroutine)
+            return true;
+    }
+    return false;
+}
+
+@interface CoroutineSchedulerTests : XCTestCase
+
+@end
+
+@implementation CoroutineSchedulerTests
+
+- (void)testNextFrameResumesAtTheNextAdvance
+{
+    int coroutine;
+    CoroutineScheduler scheduler;
+    scheduler.ScheduleNextFrame(&coroutine);
+
+    const std::vector<void*>& batch = scheduler.Advance(0);
+    XCTAssertEqual(batch.size(), (size_t)1);
+    XCTAssertTrue(batch[0] == &coroutine);
+    XCTAssertEqual(scheduler.Advance(1).size(), (size_t)0);
+}
+
+- (void)testTimersFireAtTheFirstAdvanceAtOrAfterTheirDueTime
+{
+    int coroutine;
+    CoroutineScheduler scheduler;
+    scheduler.ScheduleAfter(&coroutine, 100);
+
+    XCTAssertEqual(scheduler.Advance(50).size(), (size_t)0);
+    XCTAssertEqual(scheduler.Advance(99).size(), (size_t)0);
+    XCTAssertEqual(scheduler.GetTimerCount(), (uint32_t)1);
+
+    const std::vector<void*>& batch = scheduler.Advance(130);
+    XCTAssertEqual(batch.size(), (size_t)1);
+    XCTAssertTrue(batch[0] == &coroutine);
+    XCTAssertEqual(scheduler.GetTimerCount(), (uint32_t)0);
+}
+
+- (void)testBatchesListNextFrameFirstAndThenTimersInTickOrder
+{
+    int late, early, nextFrame;
+    CoroutineScheduler scheduler;
+    scheduler.ScheduleAfter(&late, 20);
+    scheduler.ScheduleAfter(&early, 10);
+    scheduler.ScheduleNextFrame(&nextFrame);
+
+    const std::vector<void*>& batch = scheduler.Advance(30);
+    XCTAssertEqual(batch.size(), (size_t)3);
+    XCTAssertTrue(batch[0] == &nextFrame);
+    XCTAssertTrue(batch[1] == &early);
+    XCTAssertTrue(batch[2] == &late);
+}
+
+- (void)testLongWaitsCascadeThroughEveryWheel
+{
+    // One delay per wheel level, plus one for the overflow list.
+    const uint64_t delays[] = { 3, 255, 256, 5000, 16384, 70000, 1048576, 3000000, ((uint64_t)1 << 26) + 17 };
+    const size_t count = sizeof(delays) / sizeof(delays[0]);
+    int coroutines[count];
+
+    CoroutineScheduler scheduler(1000);
+    for (size_t i = 0; i < count; i++)
+        scheduler.ScheduleAt(&coroutines[i], 1000 + delays[i]);
+
+    // Advance in uneven steps and record when each coroutine fired.
+    std::map<void*, uint64_t> firedAt;
+    uint64_t now = 1000;
+    uint64_t step = 1;
+    while (firedAt.size() < count)
+    {
+        now += step;
+        step = step * 3 + 1;
+        if (step > 40000)
+            step = 7;
+
+        const std::vector<void*>& batch = scheduler.Advance(now);
+        for (size_t i = 0; i < batch.size(); i++)
+            firedAt[batch[i]] = now;
+    }
+
+    // Each one must fire at the first Advance at or after its due time.
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t due = 1000 + delays[i];
+        uint64_t fired = firedAt[&coroutines[i]];
+        XCTAssertTrue(fired >= due, @"delay %llu fired early", (unsigned long long)delays[i]);
+        XCTAssertTrue(fired - due < 40000, @"delay %llu fired late", (unsigned long long)delays[i]);
+    }
+    XCTAssertEqual(scheduler.GetTimerCount(), (uint32_t)0);
+}
+
+- (void)testCancelDropsPendingWakeUpsOnly
+{
+    int cancelled, kept;
+    CoroutineScheduler scheduler;
+    CoroutineScheduler::Handle cancelledHandle = scheduler.ScheduleAfter(&cancelled, 10);
+    CoroutineScheduler::Handle keptHandle = scheduler.ScheduleAfter(&kept, 10);
+
+    XCTAssertTrue(scheduler.Cancel(cancelledHandle));
+    XCTAssertFalse(scheduler.Cancel(cancelledHandle));
+
+    const std::vector<void*>& batch = scheduler.Advance(10);
+    XCTAssertEqual(batch.size(), (size_t)1);
+    XCTAssertTrue(BatchContains(batch, &kept));
+    XCTAssertFalse(scheduler.Cancel(keptHandle));
+}
+
+- (void)testStaleHandlesDoNotCancelAReusedNode
+{
+    int first, second;
+    CoroutineScheduler scheduler;
+    CoroutineScheduler::Handle stale = scheduler.ScheduleNextFrame(&first);
+    scheduler.Advance(0);
+
+    scheduler.ScheduleAfter(&second, 5);
+    XCTAssertFalse(scheduler.Cancel(stale));
+    XCTAssertTrue(BatchContains(scheduler.Advance(5), &second));
+}
+
+@end
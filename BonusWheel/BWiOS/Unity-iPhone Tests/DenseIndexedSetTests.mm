@@ -0,0 +1,135 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/DenseIndexedSet.h"
+
+typedef il2cpp::utils::DenseIndexedSet<int> IntSet;
+
+static bool IsEven(int value)
+{
+    return value % 2 == 0;
+}
+
+static bool Descending(int left, int right)
+{
+    return left > right;
+}
+
+@interface DenseIndexedSetTests : XCTestCase
+
+@end
+
+@implementation DenseIndexedSetTests
+
+- (void)testAddedItemsAreContainedAndDenselyPacked
+{
+    IntSet set;
+    IntSet::Handle a = set.Add(10);
+    IntSet::Handle b = set.Add(20);
+    IntSet::Handle c = set.Add(30);
+
+    XCTAssertTrue(a != IntSet::kInvalidHandle && b != IntSet::kInvalidHandle && c != IntSet::kInvalidHandle);
+    XCTAssertTrue(set.Contains(a) && set.Contains(b) && set.Contains(c));
+    XCTAssertFalse(set.Contains(IntSet::kInvalidHandle));
+    XCTAssertEqual(set.Count(), (size_t)3);
+    XCTAssertEqual(set[set.IndexOf(b)], 20);
+}
+
+- (void)testRemoveSwapsTheLastItemIn
+{
+    IntSet set;
+    IntSet::Handle a = set.Add(10);
+    IntSet::Handle b = set.Add(20);
+    IntSet::Handle c = set.Add(30);
+
+    XCTAssertTrue(set.Remove(a));
+    XCTAssertFalse(set.Contains(a));
+    XCTAssertEqual(set.Count(), (size_t)2);
+    XCTAssertEqual(set[0], 30);
+    XCTAssertEqual(set.IndexOf(c), (size_t)0);
+    XCTAssertEqual(set.IndexOf(b), (size_t)1);
+    XCTAssertFalse(set.Remove(a));
+}
+
+- (void)testStaleHandlesDoNotMatchAReusedSlot
+{
+    IntSet set;
+    IntSet::Handle removed = set.Add(1);
+    set.Remove(removed);
+
+    IntSet::Handle reused = set.Add(2);
+    XCTAssertFalse(set.Contains(removed));
+    XCTAssertFalse(set.Remove(removed));
+    XCTAssertTrue(set.Contains(reused));
+    XCTAssertEqual(set.Count(), (size_t)1);
+    XCTAssertEqual(set[0], 2);
+}
+
+- (void)testClearInvalidatesEveryHandle
+{
+    IntSet set;
+    IntSet::Handle a = set.Add(1);
+    IntSet::Handle b = set.Add(2);
+    set.Clear();
+
+    XCTAssertEqual(set.Count(), (size_t)0);
+    XCTAssertFalse(set.Contains(a));
+    XCTAssertFalse(set.Contains(b));
+
+    IntSet::Handle c = set.Add(3);
+    XCTAssertTrue(set.Contains(c));
+    XCTAssertFalse(set.Contains(a) || set.Contains(b));
+}
+
+- (void)testAddUniqueOnlyAddsOnce
+{
+    IntSet set;
+    IntSet::Handle handle = IntSet::kInvalidHandle;
+
+    XCTAssertTrue(set.AddUnique(handle, 5));
+    XCTAssertFalse(set.AddUnique(handle, 5));
+    XCTAssertEqual(set.Count(), (size_t)1);
+
+    set.Remove(handle);
+    XCTAssertTrue(set.AddUnique(handle, 5));
+    XCTAssertEqual(set.Count(), (size_t)1);
+}
+
+- (void)testRemoveAllAndSortKeepTheRemainingHandlesValid
+{
+    IntSet set;
+    IntSet::Handle handles[6];
+    for (int i = 0; i < 6; i++)
+        handles[i] = set.Add(i);
+
+    XCTAssertEqual(set.RemoveAll(IsEven), (size_t)3);
+    XCTAssertEqual(set.Count(), (size_t)3);
+    for (int i = 0; i < 6; i++)
+        XCTAssertEqual(set.Contains(handles[i]), i % 2 != 0);
+
+    set.Sort(Descending);
+    XCTAssertEqual(set[0], 5);
+    XCTAssertEqual(set[1], 3);
+    XCTAssertEqual(set[2], 1);
+    XCTAssertEqual(set.IndexOf(handles[5]), (size_t)0);
+    XCTAssertEqual(set.IndexOf(handles[1]), (size_t)2);
+    XCTAssertTrue(set.Remove(handles[3]));
+    XCTAssertEqual(set.Count(), (size_t)2);
+}
+
+- (void)testHandleFromAnotherSetIsRejected
+{
+    IntSet first;
+    IntSet second;
+    IntSet::Handle a = first.Add(10);
+    IntSet::Handle b = second.Add(20);
+
+    // Both handles point at slot 0 of their set, with the same generation.
+    XCTAssertFalse(second.Contains(a));
+    XCTAssertFalse(first.Contains(b));
+    XCTAssertFalse(second.Remove(a));
+    XCTAssertEqual(second.Count(), (size_t)1);
+    XCTAssertEqual(second.IndexOf(a), (size_t)-1);
+    XCTAssertTrue(first.Contains(a) && second.Contains(b));
+}
+
+@end
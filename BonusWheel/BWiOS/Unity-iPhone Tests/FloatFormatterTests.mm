@@ -0,0 +1,164 @@
+#import <XCTest/XCTest.h>
+
+#include "il2cpp-config.h"
+#include "utils/FloatFormatter.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using il2cpp::utils::FloatFormatter;
+
+namespace
+{
+    const size_t kBenchmarkValueCount = 100000;
+
+    float FloatFromBits(uint32_t bits)
+    {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Doubles spread over the whole exponent range plus typical UI values, fixed so that
+    // runs compare.
+    struct BenchmarkValues
+    {
+        double values[kBenchmarkValueCount];
+
+        BenchmarkValues()
+        {
+            uint64_t state = 0x9E3779B97F4A7C15ULL;
+            for (size_t i = 0; i < kBenchmarkValueCount; i++)
+            {
+                state ^= state >> 12;
+                state ^= state << 25;
+                state ^= state >> 27;
+                uint64_t bits = state * 0x2545F4914F6CDD1DULL;
+                if (i % 2 == 0)
+                    values[i] = (double)(bits % 100000) / 100.0;
+                else
+                    memcpy(&values[i], &bits, sizeof(double));
+                if (values[i] != values[i])
+                    values[i] = 1.0;
+            }
+        }
+    };
+}
+
+@interface FloatFormatterTests : XCTestCase
+
+@end
+
+@implementation FloatFormatterTests
+
+- (void)testDoublesUseShortestDigits
+{
+    char buffer[FloatFormatter::kMaxFormattedLength];
+
+    FloatFormatter::Format(0.1 + 0.2, buffer);
+    XCTAssertEqual(strcmp(buffer, "0.30000000000000004"), 0);
+    FloatFormatter::Format(0.3, buffer);
+    XCTAssertEqual(strcmp(buffer, "0.3"), 0);
+    FloatFormatter::Format(100.0, buffer);
+    XCTAssertEqual(strcmp(buffer, "100"), 0);
+    FloatFormatter::Format(1e15, buffer);
+    XCTAssertEqual(strcmp(buffer, "1E+15"), 0);
+    FloatFormatter::Format(0.0001, buffer);
+    XCTAssertEqual(strcmp(buffer, "0.0001"), 0);
+    FloatFormatter::Format(0.00001, buffer);
+    XCTAssertEqual(strcmp(buffer, "1E-05"), 0);
+    FloatFormatter::Format(-1.7976931348623157e308, buffer);
+    XCTAssertEqual(strcmp(buffer, "-1.7976931348623157E+308"), 0);
+    FloatFormatter::Format(5e-324, buffer);
+    XCTAssertEqual(strcmp(buffer, "5E-324"), 0);
+}
+
+- (void)testSpecialValues
+{
+    char buffer[FloatFormatter::kMaxFormattedLength];
+
+    FloatFormatter::Format(-0.0, buffer);
+    XCTAssertEqual(strcmp(buffer, "0"), 0);
+    FloatFormatter::Format(-0.0f, buffer);
+    XCTAssertEqual(strcmp(buffer, "0"), 0);
+    FloatFormatter::Format(FloatFromBits(0x7FC00000), buffer);
+    XCTAssertEqual(strcmp(buffer, "NaN"), 0);
+    FloatFormatter::Format(FloatFromBits(0xFF800000), buffer);
+    XCTAssertEqual(strcmp(buffer, "-Infinity"), 0);
+}
+
+- (void)testSinglesUseFloatInterval
+{
+    char buffer[FloatFormatter::kMaxFormattedLength];
+
+    FloatFormatter::Format(1.1f, buffer);
+    XCTAssertEqual(strcmp(buffer, "1.1"), 0);
+    FloatFormatter::Format(16777216.0f, buffer);
+    XCTAssertEqual(strcmp(buffer, "1.6777216E+07"), 0);
+    FloatFormatter::Format(3.4028235e38f, buffer);
+    XCTAssertEqual(strcmp(buffer, "3.4028235E+38"), 0);
+}
+
+// Every finite positive float is formatted and parsed back. A negative value only gains
+// the sign, which is checked against its positive twin without parsing again. Takes a few
+// minutes on a device.
+- (void)testEverySingleRoundTrips
+{
+    char buffer[FloatFormatter::kMaxFormattedLength];
+    char negativeBuffer[FloatFormatter::kMaxFormattedLength];
+    uint64_t failures = 0;
+
+    for (uint32_t bits = 0; bits < 0x7F800000; bits++)
+    {
+        float value = FloatFromBits(bits);
+        size_t length = FloatFormatter::Format(value, buffer);
+
+        float parsed = strtof(buffer, NULL);
+        if (memcmp(&parsed, &value, sizeof(value)) != 0)
+        {
+            if (failures++ < 10)
+                XCTFail(@"0x%08x formatted as %s", bits, buffer);
+        }
+
+        if (bits != 0)
+        {
+            size_t negativeLength = FloatFormatter::Format(FloatFromBits(bits | 0x80000000), negativeBuffer);
+            if (negativeLength != length + 1 || negativeBuffer[0] != '-' || memcmp(negativeBuffer + 1, buffer, length + 1) != 0)
+            {
+                if (failures++ < 10)
+                    XCTFail(@"0x%08x formatted as %s", bits | 0x80000000, negativeBuffer);
+            }
+        }
+    }
+
+    XCTAssertEqual(failures, 0ULL);
+}
+
+- (void)testPerformanceOfFormattingDoubles
+{
+    BenchmarkValues* values = new BenchmarkValues();
+    __block size_t totalLength = 0;
+    [self measureBlock:^{
+        char buffer[FloatFormatter::kMaxFormattedLength];
+        for (size_t i = 0; i < kBenchmarkValueCount; i++)
+            totalLength += FloatFormatter::Format(values->values[i], buffer);
+    }];
+    XCTAssertTrue(totalLength > 0);
+    delete values;
+}
+
+// Reference point: the C library's 17 digit formatting, which round-trips but is not shortest.
+- (void)testPerformanceOfFormattingDoublesWithSnprintf
+{
+    BenchmarkValues* values = new BenchmarkValues();
+    __block size_t totalLength = 0;
+    [self measureBlock:^{
+        char buffer[FloatFormatter::kMaxFormattedLength];
+        for (size_t i = 0; i < kBenchmarkValueCount; i++)
+            totalLength += snprintf(buffer, sizeof(buffer), "%.17G", values->values[i]);
+    }];
+    XCTAssertTrue(totalLength > 0);
+    delete values;
+}
+
+@end
@@ -0,0 +1,174 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/ObjectLiveness.h"
+
+using il2cpp::utils::LivenessToken;
+using il2cpp::utils::ObjectLiveness;
+
+namespace
+{
+    const size_t kObjectCount = 1024;
+    const int kRounds = 2000;
+
+    // What the generated `obj == null` runs today, ported from UnityEngine.CoreModule.cpp:
+    // Object_op_Equality calls CompareBaseObjects, which calls IsNativeObjectAlive, which
+    // calls GetCachedPtr. Each has its method initialization guard and CompareBaseObjects
+    // runs the class initialization check; the engine clears m_CachedPtr on destroy.
+    struct FakeObject
+    {
+        void* klass;
+        void* monitor;
+        intptr_t m_CachedPtr;
+    };
+
+    volatile bool s_ClassInitialized = true;
+    bool s_GetCachedPtrInitialized = true;
+    bool s_IsNativeObjectAliveInitialized = true;
+    bool s_CompareBaseObjectsInitialized = true;
+
+    __attribute__((noinline)) intptr_t GetCachedPtr(FakeObject* object)
+    {
+        return object->m_CachedPtr;
+    }
+
+    __attribute__((noinline)) bool IsNativeObjectAlive(FakeObject* object)
+    {
+        if (!s_IsNativeObjectAliveInitialized)
+            s_IsNativeObjectAliveInitialized = true;
+        return GetCachedPtr(object) != 0;
+    }
+
+    __attribute__((noinline)) bool CompareBaseObjects(FakeObject* lhs, FakeObject* rhs)
+    {
+        if (!s_CompareBaseObjectsInitialized)
+            s_CompareBaseObjectsInitialized = true;
+
+        bool lhsNull = lhs == NULL;
+        bool rhsNull = rhs == NULL;
+        if (lhsNull && rhsNull)
+            return true;
+        if (!s_ClassInitialized)
+            s_ClassInitialized = true;
+        if (rhsNull)
+            return !IsNativeObjectAlive(lhs);
+        if (lhsNull)
+            return !IsNativeObjectAlive(rhs);
+        return lhs == rhs;
+    }
+
+    // The same objects two ways: registered liveness tokens and wrappers with a cached
+    // pointer. Every third object is destroyed.
+    struct Objects
+    {
+        LivenessToken tokens[kObjectCount];
+        FakeObject wrappers[kObjectCount];
+
+        Objects()
+        {
+            for (size_t i = 0; i < kObjectCount; i++)
+            {
+                tokens[i] = ObjectLiveness::Register();
+                wrappers[i].klass = NULL;
+                wrappers[i].monitor = NULL;
+                wrappers[i].m_CachedPtr = (intptr_t)&tokens[i];
+            }
+
+            for (size_t i = 0; i < kObjectCount; i += 3)
+            {
+                ObjectLiveness::MarkDestroyed(tokens[i]);
+                wrappers[i].m_CachedPtr = 0;
+            }
+        }
+
+        ~Objects()
+        {
+            for (size_t i = 0; i < kObjectCount; i++)
+                ObjectLiveness::MarkDestroyed(tokens[i]);
+        }
+    };
+}
+
+@interface ObjectLivenessTests : XCTestCase
+
+@end
+
+@implementation ObjectLivenessTests
+
+- (void)testDestroyedObjectsReportDeadThroughEveryCopy
+{
+    LivenessToken token = ObjectLiveness::Register();
+    LivenessToken copy = token;
+    XCTAssertTrue(ObjectLiveness::IsAlive(token));
+    XCTAssertTrue(ObjectLiveness::IsAlive(copy));
+
+    ObjectLiveness::MarkDestroyed(token);
+    XCTAssertFalse(ObjectLiveness::IsAlive(token));
+    XCTAssertFalse(ObjectLiveness::IsAlive(copy));
+
+    XCTAssertFalse(ObjectLiveness::IsAlive(LivenessToken()));
+}
+
+- (void)testRecycledWordKeepsOldTokensDead
+{
+    LivenessToken first = ObjectLiveness::Register();
+    ObjectLiveness::MarkDestroyed(first);
+
+    // The freed word is the next one handed out, with the next odd generation.
+    LivenessToken second = ObjectLiveness::Register();
+    XCTAssertTrue(second.word == first.word);
+    XCTAssertEqual(second.generation, first.generation + 2);
+    XCTAssertFalse(ObjectLiveness::IsAlive(first));
+    XCTAssertTrue(ObjectLiveness::IsAlive(second));
+
+    // Destroying through the stale token does not touch the new object.
+    ObjectLiveness::MarkDestroyed(first);
+    XCTAssertTrue(ObjectLiveness::IsAlive(second));
+    ObjectLiveness::MarkDestroyed(second);
+}
+
+- (void)testDestroyingTwiceFreesTheWordOnce
+{
+    LivenessToken token = ObjectLiveness::Register();
+    ObjectLiveness::MarkDestroyed(token);
+    ObjectLiveness::MarkDestroyed(token);
+
+    LivenessToken first = ObjectLiveness::Register();
+    LivenessToken second = ObjectLiveness::Register();
+    XCTAssertTrue(first.word != second.word);
+    XCTAssertTrue(ObjectLiveness::IsAlive(first) && ObjectLiveness::IsAlive(second));
+
+    ObjectLiveness::MarkDestroyed(first);
+    ObjectLiveness::MarkDestroyed(second);
+}
+
+- (void)testPerformanceOfTokenChecks
+{
+    Objects* objects = new Objects();
+    __block size_t aliveCount = 0;
+    [self measureBlock:^{
+        for (int round = 0; round < kRounds; round++)
+        {
+            for (size_t i = 0; i < kObjectCount; i++)
+                aliveCount += ObjectLiveness::IsAlive(objects->tokens[i]);
+        }
+    }];
+    XCTAssertTrue(aliveCount > 0);
+    delete objects;
+}
+
+- (void)testPerformanceOfGeneratedNullChecks
+{
+    Objects* objects = new Objects();
+    __block size_t aliveCount = 0;
+    [self measureBlock:^{
+        for (int round = 0; round < kRounds; round++)
+        {
+            for (size_t i = 0; i < kObjectCount; i++)
+                aliveCount += !CompareBaseObjects(&objects->wrappers[i], NULL);
+        }
+    }];
+    XCTAssertTrue(aliveCount > 0);
+    delete objects;
+}
+
+@end
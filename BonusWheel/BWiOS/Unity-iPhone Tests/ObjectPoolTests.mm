@@ -0,0 +1,100 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/ObjectPool.h"
+#include <thread>
+
+using il2cpp::utils::ObjectPool;
+
+namespace
+{
+    struct ItemLog
+    {
+        int created;
+        int destroyed;
+
+        ItemLog() : created(0), destroyed(0) {}
+    };
+
+    void* CreateItem(void* context)
+    {
+        static_cast<ItemLog*>(context)->created++;
+        return new int(0);
+    }
+
+    void DestroyItem(void* item, void* context)
+    {
+        static_cast<ItemLog*>(context)->destroyed++;
+        delete static_cast<int*>(item);
+    }
+}
+
+@interface ObjectPoolTests : XCTestCase
+
+@end
+
+@implementation ObjectPoolTests
+
+- (void)testReleasedItemIsReused
+{
+    ItemLog log;
+    ObjectPool pool(CreateItem, NULL, NULL, DestroyItem, &log);
+
+    void* item = pool.Get();
+    pool.Release(item);
+    XCTAssertTrue(pool.Get() == item);
+    XCTAssertEqual(log.created, 1);
+    pool.Release(item);
+
+    ObjectPool::Statistics stats = pool.GetStatistics();
+    XCTAssertEqual(stats.getCount, 2u);
+    XCTAssertEqual(stats.releaseCount, 2u);
+    XCTAssertEqual(stats.missCount, 1u);
+    XCTAssertEqual(stats.liveCount, 1);
+}
+
+- (void)testSharedListIsTrimmedToHighWaterMark
+{
+    ItemLog log;
+    ObjectPool pool(CreateItem, NULL, NULL, DestroyItem, &log, 4);
+
+    void* items[ObjectPool::kThreadCacheCapacity + 1];
+    for (size_t i = 0; i < ObjectPool::kThreadCacheCapacity + 1; i++)
+        items[i] = pool.Get();
+    for (size_t i = 0; i < ObjectPool::kThreadCacheCapacity + 1; i++)
+        pool.Release(items[i]);
+
+    // The full cache spilled a batch, of which only the high-water mark is kept.
+    ObjectPool::Statistics stats = pool.GetStatistics();
+    XCTAssertEqual(stats.sharedCount, 4u);
+    XCTAssertEqual(stats.destroyCount, (uint64_t)(ObjectPool::kBatch - 4));
+    XCTAssertEqual(log.destroyed, (int)(ObjectPool::kBatch - 4));
+}
+
+- (void)testExitedThreadReturnsItsCache
+{
+    ItemLog log;
+    ObjectPool pool(CreateItem, NULL, NULL, DestroyItem, &log);
+
+    std::thread worker([&pool]() {
+        void* first = pool.Get();
+        void* second = pool.Get();
+        pool.Release(first);
+        pool.Release(second);
+    });
+    worker.join();
+
+    // Both items went back to the shared list and the thread's counters survived it.
+    ObjectPool::Statistics stats = pool.GetStatistics();
+    XCTAssertEqual(stats.sharedCount, 2u);
+    XCTAssertEqual(stats.getCount, 2u);
+    XCTAssertEqual(stats.releaseCount, 2u);
+    XCTAssertEqual(stats.missCount, 2u);
+
+    void* first = pool.Get();
+    void* second = pool.Get();
+    XCTAssertEqual(log.created, 2);
+    pool.Release(first);
+    pool.Release(second);
+}
+
+@end
@@ -0,0 +1,276 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/PrefabPool.h"
+
+using il2cpp::utils::PrefabPool;
+
+namespace
+{
+    // Instances are slots in a fixed array, so they stay distinct and never need freeing.
+    struct FakeScene
+    {
+        int instances[64];
+        int nextInstance;
+        int activated;
+        int deactivated;
+        int destroyed;
+    };
+
+    void* Instantiate(void*, void* context)
+    {
+        FakeScene* scene = static_cast<FakeScene*>(context);
+        return &scene->instances[scene->nextInstance++];
+    }
+
+    void Activate(void*, const PrefabPool::Placement&, void* context)
+    {
+        static_cast<FakeScene*>(context)->activated++;
+    }
+
+    void Deactivate(void*, void* context)
+    {
+        static_cast<FakeScene*>(context)->deactivated++;
+    }
+
+    void Destroy(void*, void* context)
+    {
+        static_cast<FakeScene*>(context)->destroyed++;
+    }
+
+    FakeScene MakeScene()
+    {
+        FakeScene scene = {};
+        return scene;
+    }
+
+    // A scene whose callbacks use the pool for other prefabs, the way an Awake or
+    // OnDisable spawning pooled children would.
+    struct NestingScene
+    {
+        FakeScene scene;
+        PrefabPool* pool;
+        int nestedPrefabs[32];
+        bool nesting;
+    };
+
+    void PrewarmNestedPrefabs(NestingScene* nesting)
+    {
+        if (nesting->nesting)
+            return;
+
+        nesting->nesting = true;
+        for (int i = 0; i < 32; i++)
+            nesting->pool->Prewarm(&nesting->nestedPrefabs[i], 1);
+        nesting->nesting = false;
+    }
+
+    void* InstantiateNesting(void* prefab, void* context)
+    {
+        NestingScene* nesting = static_cast<NestingScene*>(context);
+        PrewarmNestedPrefabs(nesting);
+        return Instantiate(prefab, &nesting->scene);
+    }
+
+    void DeactivateNesting(void*, void* context)
+    {
+        NestingScene* nesting = static_cast<NestingScene*>(context);
+        PrewarmNestedPrefabs(nesting);
+        nesting->scene.deactivated++;
+    }
+
+    void ActivateNesting(void* instance, const PrefabPool::Placement& placement, void* context)
+    {
+        Activate(instance, placement, &static_cast<NestingScene*>(context)->scene);
+    }
+
+    void DestroyNesting(void* instance, void* context)
+    {
+        Destroy(instance, &static_cast<NestingScene*>(context)->scene);
+    }
+
+    // A destroy callback that spawns and releases an effect, the way an OnDestroy that
+    // leaves a pooled particle behind would.
+    struct EffectScene
+    {
+        FakeScene scene;
+        PrefabPool* pool;
+        int effectPrefab;
+        void* effect;
+    };
+
+    void DestroyWithEffect(void* instance, void* context)
+    {
+        EffectScene* effects = static_cast<EffectScene*>(context);
+        Destroy(instance, &effects->scene);
+        if (instance == effects->effect)
+            return;
+
+        PrefabPool::Placement placement = {};
+        effects->effect = effects->pool->Spawn(&effects->effectPrefab, placement);
+        effects->pool->Release(effects->effect);
+    }
+
+    void* InstantiateEffect(void* prefab, void* context)
+    {
+        return Instantiate(prefab, &static_cast<EffectScene*>(context)->scene);
+    }
+
+    void ActivateEffect(void* instance, const PrefabPool::Placement& placement, void* context)
+    {
+        Activate(instance, placement, &static_cast<EffectScene*>(context)->scene);
+    }
+
+    void DeactivateEffect(void* instance, void* context)
+    {
+        Deactivate(instance, &static_cast<EffectScene*>(context)->scene);
+    }
+}
+
+@interface PrefabPoolTests : XCTestCase
+
+@end
+
+@implementation PrefabPoolTests
+
+- (void)testReleasedInstancesAreSpawnedAgain
+{
+    int prefab;
+    FakeScene scene = MakeScene();
+    PrefabPool pool(Instantiate, Activate, Deactivate, Destroy, &scene);
+    PrefabPool::Placement placement = {};
+
+    void* first = pool.Spawn(&prefab, placement);
+    XCTAssertTrue(first != NULL);
+    XCTAssertTrue(pool.Release(first));
+    XCTAssertEqual(scene.deactivated, 1);
+
+    void* second = pool.Spawn(&prefab, placement);
+    XCTAssertTrue(second == first);
+    XCTAssertEqual(scene.nextInstance, 1);
+    XCTAssertEqual(scene.activated, 2);
+
+    PrefabPool::Statistics stats = pool.GetStatistics(&prefab);
+    XCTAssertEqual(stats.hitCount, (uint64_t)1);
+    XCTAssertEqual(stats.missCount, (uint64_t)1);
+    XCTAssertEqual(stats.releaseCount, (uint64_t)1);
+    XCTAssertEqual(stats.activeCount, (size_t)1);
+    XCTAssertEqual(stats.pooledCount, (size_t)0);
+}
+
+- (void)testReleaseBeyondCapacityDestroysTheInstance
+{
+    int prefab;
+    FakeScene scene = MakeScene();
+    PrefabPool pool(Instantiate, Activate, Deactivate, Destroy, &scene);
+    PrefabPool::Placement placement = {};
+    pool.SetCapacity(&prefab, 1);
+
+    void* first = pool.Spawn(&prefab, placement);
+    void* second = pool.Spawn(&prefab, placement);
+    XCTAssertTrue(pool.Release(first));
+    XCTAssertTrue(pool.Release(second));
+
+    XCTAssertEqual(scene.destroyed, 1);
+    XCTAssertEqual(pool.GetStatistics(&prefab).pooledCount, (size_t)1);
+    XCTAssertEqual(pool.GetStatistics(&prefab).destroyCount, (uint64_t)1);
+}
+
+- (void)testPrewarmFillsThePoolAndRaisesTheCapacity
+{
+    int prefab;
+    FakeScene scene = MakeScene();
+    PrefabPool pool(Instantiate, Activate, Deactivate, Destroy, &scene);
+    PrefabPool::Placement placement = {};
+    pool.SetCapacity(&prefab, 2);
+
+    pool.Prewarm(&prefab, 4);
+    XCTAssertEqual(scene.nextInstance, 4);
+    XCTAssertEqual(scene.deactivated, 4);
+    XCTAssertEqual(pool.GetStatistics(&prefab).pooledCount, (size_t)4);
+
+    for (int i = 0; i < 4; i++)
+        pool.Spawn(&prefab, placement);
+    XCTAssertEqual(scene.nextInstance, 4);
+    XCTAssertEqual(pool.GetStatistics(&prefab).hitCount, (uint64_t)4);
+}
+
+- (void)testForeignInstancesAreDestroyedOutright
+{
+    int prefab, foreign;
+    FakeScene scene = MakeScene();
+    PrefabPool pool(Instantiate, Activate, Deactivate, Destroy, &scene);
+
+    XCTAssertFalse(pool.Release(&foreign));
+    XCTAssertEqual(scene.destroyed, 1);
+    XCTAssertEqual(pool.GetStatistics(&prefab).releaseCount, (uint64_t)0);
+}
+
+- (void)testCallbacksMayAddPoolsForOtherPrefabs
+{
+    int prefab;
+    NestingScene nesting = {};
+    PrefabPool pool(InstantiateNesting, ActivateNesting, DeactivateNesting, DestroyNesting, &nesting);
+    nesting.pool = &pool;
+    PrefabPool::Placement placement = {};
+
+    // The instantiate callback adds 32 pools while Spawn works on the first one.
+    void* instance = pool.Spawn(&prefab, placement);
+    XCTAssertTrue(instance != NULL);
+    PrefabPool::Statistics stats = pool.GetStatistics(&prefab);
+    XCTAssertEqual(stats.missCount, (uint64_t)1);
+    XCTAssertEqual(stats.activeCount, (size_t)1);
+    XCTAssertEqual(pool.GetStatistics(&nesting.nestedPrefabs[31]).pooledCount, (size_t)1);
+
+    // Same for Release through the deactivate callback, on a pool created afterwards.
+    int laterPrefab;
+    void* later = pool.Spawn(&laterPrefab, placement);
+    XCTAssertTrue(pool.Release(later));
+    stats = pool.GetStatistics(&laterPrefab);
+    XCTAssertEqual(stats.releaseCount, (uint64_t)1);
+    XCTAssertEqual(stats.pooledCount, (size_t)1);
+    XCTAssertEqual(stats.activeCount, (size_t)0);
+
+    // And for Prewarm, whose loop instantiates and deactivates.
+    int prewarmedPrefab;
+    pool.Prewarm(&prewarmedPrefab, 3);
+    XCTAssertEqual(pool.GetStatistics(&prewarmedPrefab).pooledCount, (size_t)3);
+}
+
+- (void)testClearDestroysPooledInstancesOnly
+{
+    int prefab;
+    FakeScene scene = MakeScene();
+    PrefabPool pool(Instantiate, Activate, Deactivate, Destroy, &scene);
+    PrefabPool::Placement placement = {};
+
+    void* active = pool.Spawn(&prefab, placement);
+    pool.Prewarm(&prefab, 3);
+    pool.Clear();
+    XCTAssertEqual(scene.destroyed, 3);
+
+    // The pool forgot the active instance, so releasing it destroys it.
+    XCTAssertFalse(pool.Release(active));
+    XCTAssertEqual(scene.destroyed, 4);
+}
+
+- (void)testDestroyCallbacksMayUseThePoolDuringClear
+{
+    int prefab;
+    EffectScene effects = {};
+    PrefabPool pool(InstantiateEffect, ActivateEffect, DeactivateEffect, DestroyWithEffect, &effects);
+    effects.pool = &pool;
+
+    pool.Prewarm(&prefab, 3);
+    pool.Clear();
+
+    // Each destroyed instance left an effect in a pool created during Clear; the first
+    // effect was pooled and reused by the other two.
+    XCTAssertEqual(effects.scene.destroyed, 3);
+    XCTAssertEqual(pool.GetStatistics(&prefab).pooledCount, (size_t)0);
+    PrefabPool::Statistics stats = pool.GetStatistics(&effects.effectPrefab);
+    XCTAssertEqual(stats.missCount, (uint64_t)1);
+    XCTAssertEqual(stats.hitCount, (uint64_t)2);
+    XCTAssertEqual(stats.pooledCount, (size_t)1);
+}
+
+@end
@@ -0,0 +1,91 @@
+// The test bundle does not link libil2cpp, whose symbols stay inside UnityFramework, so the
+// few runtime functions the header-only utilities under test call are provided here: the
+// allocator behind IL2CPP_MALLOC and dynamic_array, and os::FastMutex. They only serve the
+// test code; the runtime in the host app keeps its own.
+
+#include "il2cpp-config.h"
+#include "os/Mutex.h"
+#include "utils/Memory.h"
+#include <mutex>
+#include <stdlib.h>
+
+namespace il2cpp
+{
+namespace utils
+{
+    void* Memory::Malloc(size_t size)
+    {
+        return malloc(size);
+    }
+
+    void* Memory::AlignedMalloc(size_t size, size_t alignment)
+    {
+        void* memory = NULL;
+        if (posix_memalign(&memory, alignment < sizeof(void*) ? sizeof(void*) : alignment, size) != 0)
+            return NULL;
+        return memory;
+    }
+
+    void Memory::Free(void* memory)
+    {
+        free(memory);
+    }
+
+    void Memory::AlignedFree(void* memory)
+    {
+        free(memory);
+    }
+
+    void* Memory::Calloc(size_t count, size_t size)
+    {
+        return calloc(count, size);
+    }
+
+    void* Memory::Realloc(void* memory, size_t newSize)
+    {
+        return realloc(memory, newSize);
+    }
+
+    // malloc is 16 byte aligned on Apple platforms, which covers the alignments the tested
+    // containers ask for.
+    void* Memory::AlignedRealloc(void* memory, size_t newSize, size_t alignment)
+    {
+        IL2CPP_ASSERT(alignment <= 16);
+        return realloc(memory, newSize);
+    }
+} /* namespace utils */
+
+namespace os
+{
+    class FastMutexImpl
+    {
+    public:
+        std::mutex mutex;
+    };
+
+    FastMutex::FastMutex()
+        : m_Impl(new FastMutexImpl())
+    {
+    }
+
+    FastMutex::~FastMutex()
+    {
+        delete m_Impl;
+    }
+
+    void FastMutex::Lock()
+    {
+        m_Impl->mutex.lock();
+    }
+
+    void FastMutex::Unlock()
+    {
+        m_Impl->mutex.unlock();
+    }
+
+    FastMutexImpl* FastMutex::GetImpl()
+    {
+        return m_Impl;
+    }
+} /* namespace os */
+} /* namespace il2cpp */
@@ -0,0 +1,130 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/UILayoutCache.h"
+
+using il2cpp::utils::UILayoutCache;
+
+namespace
+{
+    struct CollectCounter
+    {
+        int calls;
+        void* element;
+        void* controller;
+    };
+
+    void CollectComponents(void* node, std::vector<void*>& layoutElements, std::vector<void*>& layoutControllers, void* context)
+    {
+        CollectCounter* counter = static_cast<CollectCounter*>(context);
+        counter->calls++;
+        layoutElements.push_back(counter->element);
+        layoutElements.push_back(node);
+        layoutControllers.push_back(counter->controller);
+    }
+
+    UILayoutCache::LayoutSizes MakeSizes(float size)
+    {
+        UILayoutCache::LayoutSizes sizes = { size, size * 2, 1.0f };
+        return sizes;
+    }
+}
+
+@interface UILayoutCacheTests : XCTestCase
+
+@end
+
+@implementation UILayoutCacheTests
+
+- (void)testComponentsAreCollectedOnceUntilInvalidated
+{
+    int element, controller, node;
+    CollectCounter counter = { 0, &element, &controller };
+    UILayoutCache cache(CollectComponents, &counter);
+
+    XCTAssertEqual(cache.GetLayoutElements(&node).size(), (size_t)2);
+    XCTAssertTrue(cache.GetLayoutElements(&node)[1] == &node);
+    XCTAssertTrue(cache.GetLayoutControllers(&node)[0] == &controller);
+    XCTAssertEqual(counter.calls, 1);
+
+    cache.InvalidateComponents(&node);
+    XCTAssertEqual(cache.GetLayoutControllers(&node).size(), (size_t)1);
+    XCTAssertEqual(counter.calls, 2);
+}
+
+- (void)testSizesAreMemoizedPerAxis
+{
+    int node;
+    CollectCounter counter = { 0, NULL, NULL };
+    UILayoutCache cache(CollectComponents, &counter);
+
+    UILayoutCache::LayoutSizes sizes;
+    XCTAssertFalse(cache.TryGetSizes(&node, UILayoutCache::kHorizontal, &sizes));
+
+    cache.StoreSizes(&node, UILayoutCache::kHorizontal, MakeSizes(10));
+    XCTAssertTrue(cache.TryGetSizes(&node, UILayoutCache::kHorizontal, &sizes));
+    XCTAssertEqual(sizes.preferredSize, 20.0f);
+    XCTAssertFalse(cache.TryGetSizes(&node, UILayoutCache::kVertical, &sizes));
+}
+
+- (void)testMarkDirtyInvalidatesAncestorsButNotSiblings
+{
+    int root, child, sibling, leaf;
+    CollectCounter counter = { 0, NULL, NULL };
+    UILayoutCache cache(CollectComponents, &counter);
+    cache.SetParent(&child, &root);
+    cache.SetParent(&sibling, &root);
+    cache.SetParent(&leaf, &child);
+
+    void* nodes[] = { &root, &child, &sibling, &leaf };
+    for (size_t i = 0; i < 4; i++)
+        cache.StoreSizes(nodes[i], UILayoutCache::kVertical, MakeSizes(1));
+
+    cache.MarkDirty(&leaf);
+
+    UILayoutCache::LayoutSizes sizes;
+    XCTAssertFalse(cache.TryGetSizes(&leaf, UILayoutCache::kVertical, &sizes));
+    XCTAssertFalse(cache.TryGetSizes(&child, UILayoutCache::kVertical, &sizes));
+    XCTAssertFalse(cache.TryGetSizes(&root, UILayoutCache::kVertical, &sizes));
+    XCTAssertTrue(cache.TryGetSizes(&sibling, UILayoutCache::kVertical, &sizes));
+}
+
+- (void)testListsStayValidWhileChildrenAreVisited
+{
+    // PerformLayoutCalculation holds a node's list while it recurses into the children,
+    // which adds entries for nodes seen for the first time.
+    int element, controller, root;
+    int children[64];
+    CollectCounter counter = { 0, &element, &controller };
+    UILayoutCache cache(CollectComponents, &counter);
+
+    const std::vector<void*>& rootElements = cache.GetLayoutElements(&root);
+    const std::vector<void*>& rootControllers = cache.GetLayoutControllers(&root);
+    for (size_t i = 0; i < 64; i++)
+    {
+        cache.SetParent(&children[i], &root);
+        XCTAssertEqual(cache.GetLayoutElements(&children[i]).size(), (size_t)2);
+    }
+
+    XCTAssertEqual(rootElements.size(), (size_t)2);
+    XCTAssertTrue(rootElements[1] == &root);
+    XCTAssertTrue(rootControllers[0] == &controller);
+    XCTAssertTrue(&cache.GetLayoutElements(&root) == &rootElements);
+}
+
+- (void)testForgetDirtiesTheAncestors
+{
+    int root, child;
+    CollectCounter counter = { 0, NULL, NULL };
+    UILayoutCache cache(CollectComponents, &counter);
+    cache.SetParent(&child, &root);
+    cache.StoreSizes(&root, UILayoutCache::kHorizontal, MakeSizes(1));
+    cache.StoreSizes(&child, UILayoutCache::kHorizontal, MakeSizes(1));
+
+    cache.Forget(&child);
+
+    UILayoutCache::LayoutSizes sizes;
+    XCTAssertFalse(cache.TryGetSizes(&root, UILayoutCache::kHorizontal, &sizes));
+    XCTAssertFalse(cache.TryGetSizes(&child, UILayoutCache::kHorizontal, &sizes));
+}
+
+@end
@@ -0,0 +1,145 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/UIMeshEffects.h"
+#include <string.h>
+#include <vector>
+
+using il2cpp::utils::UIColor32;
+using il2cpp::utils::UIMeshEffects;
+using il2cpp::utils::UIVector2;
+using il2cpp::utils::UIVertex;
+
+namespace
+{
+    const size_t kVertexCount = 7;
+
+    UIVector2 MakeVector(float x, float y)
+    {
+        UIVector2 vector = { x, y };
+        return vector;
+    }
+
+    // Distinct values in every channel, so a vertex copied from the wrong index or a field
+    // copied from the wrong offset shows up in the comparison.
+    std::vector<UIVertex> MakeVertices()
+    {
+        std::vector<UIVertex> vertices(kVertexCount);
+        for (size_t i = 0; i < kVertexCount; i++)
+        {
+            float base = (float)(i * 100);
+            UIVertex& vertex = vertices[i];
+            vertex.position.x = base + 1.5f;
+            vertex.position.y = base - 2.25f;
+            vertex.position.z = base + 3;
+            vertex.normal.x = base + 4;
+            vertex.normal.y = base + 5;
+            vertex.normal.z = base + 6;
+            vertex.tangent.x = base + 7;
+            vertex.tangent.y = base + 8;
+            vertex.tangent.z = base + 9;
+            vertex.tangent.w = base + 10;
+            vertex.color.r = (uint8_t)(i * 30);
+            vertex.color.g = (uint8_t)(i * 30 + 1);
+            vertex.color.b = (uint8_t)(i * 30 + 2);
+            vertex.color.a = (uint8_t)(255 - i * 37);
+            vertex.uv0 = MakeVector(base + 11, base + 12);
+            vertex.uv1 = MakeVector(base + 13, base + 14);
+            vertex.uv2 = MakeVector(base + 15, base + 16);
+            vertex.uv3 = MakeVector(base + 17, base + 18);
+        }
+        return vertices;
+    }
+
+    // Shadow.ApplyShadowZeroAlloc as UnityEngine.UI implements it: append a copy of
+    // [start, end), then turn the original range into the shadow.
+    void ApplyShadowZeroAlloc(std::vector<UIVertex>& vertices, UIColor32 color, size_t start, size_t end, float x, float y, bool useGraphicAlpha)
+    {
+        for (size_t i = start; i < end; i++)
+        {
+            UIVertex vertex = vertices[i];
+            vertices.push_back(vertex);
+
+            vertex.position.x += x;
+            vertex.position.y += y;
+            UIColor32 shadowColor = color;
+            if (useGraphicAlpha)
+                shadowColor.a = (uint8_t)((shadowColor.a * vertices[i].color.a) / 255);
+            vertex.color = shadowColor;
+            vertices[i] = vertex;
+        }
+    }
+
+    // Outline.ModifyMesh: each pass works on the range the previous one appended.
+    void ApplyOutlineReference(std::vector<UIVertex>& vertices, UIColor32 color, float x, float y, bool useGraphicAlpha)
+    {
+        size_t start = 0;
+        size_t end = vertices.size();
+        ApplyShadowZeroAlloc(vertices, color, start, vertices.size(), x, y, useGraphicAlpha);
+        start = end;
+        end = vertices.size();
+        ApplyShadowZeroAlloc(vertices, color, start, vertices.size(), x, -y, useGraphicAlpha);
+        start = end;
+        end = vertices.size();
+        ApplyShadowZeroAlloc(vertices, color, start, vertices.size(), -x, y, useGraphicAlpha);
+        start = end;
+        end = vertices.size();
+        ApplyShadowZeroAlloc(vertices, color, start, vertices.size(), -x, -y, useGraphicAlpha);
+    }
+
+    bool SameVertices(const std::vector<UIVertex>& expected, const std::vector<UIVertex>& actual)
+    {
+        return expected.size() == actual.size() && memcmp(&expected[0], &actual[0], expected.size() * sizeof(UIVertex)) == 0;
+    }
+}
+
+@interface UIMeshEffectsTests : XCTestCase
+
+@end
+
+@implementation UIMeshEffectsTests
+
+- (void)testShadowMatchesApplyShadowZeroAlloc
+{
+    const UIColor32 color = { 10, 20, 30, 128 };
+    for (int useGraphicAlpha = 0; useGraphicAlpha < 2; useGraphicAlpha++)
+    {
+        std::vector<UIVertex> expected = MakeVertices();
+        ApplyShadowZeroAlloc(expected, color, 0, expected.size(), 1.5f, -2.0f, useGraphicAlpha != 0);
+
+        std::vector<UIVertex> actual = MakeVertices();
+        actual.resize(kVertexCount * 2);
+        UIMeshEffects::ApplyShadow(&actual[0], kVertexCount, MakeVector(1.5f, -2.0f), color, useGraphicAlpha != 0);
+
+        XCTAssertTrue(SameVertices(expected, actual));
+    }
+}
+
+- (void)testOutlineMatchesFourChainedShadowPasses
+{
+    const UIColor32 color = { 200, 100, 50, 255 };
+    for (int useGraphicAlpha = 0; useGraphicAlpha < 2; useGraphicAlpha++)
+    {
+        std::vector<UIVertex> expected = MakeVertices();
+        ApplyOutlineReference(expected, color, 2.0f, 0.75f, useGraphicAlpha != 0);
+
+        std::vector<UIVertex> actual = MakeVertices();
+        actual.resize(kVertexCount * 5);
+        UIMeshEffects::ApplyOutline(&actual[0], kVertexCount, MakeVector(2.0f, 0.75f), color, useGraphicAlpha != 0);
+
+        XCTAssertTrue(SameVertices(expected, actual));
+    }
+}
+
+- (void)testGraphicAlphaScalesShadowAlpha
+{
+    const UIColor32 color = { 0, 0, 0, 200 };
+    std::vector<UIVertex> vertices = MakeVertices();
+    vertices.resize(kVertexCount * 2);
+    UIMeshEffects::ApplyShadow(&vertices[0], kVertexCount, MakeVector(1, 1), color, true);
+
+    // Source alpha 255 - 37 = 218 scales 200 down to 170.
+    XCTAssertEqual(vertices[1].color.a, 170);
+    XCTAssertEqual(vertices[kVertexCount + 1].color.a, 218);
+}
+
+@end
@@ -0,0 +1,133 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/UIRaycastGrid.h"
+#include <math.h>
+#include <vector>
+
+using il2cpp::utils::UIRaycastGrid;
+
+namespace
+{
+    UIRaycastGrid::Rect MakeRect(float xMin, float yMin, float xMax, float yMax)
+    {
+        UIRaycastGrid::Rect rect = { xMin, yMin, xMax, yMax };
+        return rect;
+    }
+
+    const UIRaycastGrid::Rect kScreen = { 0, 0, 1024, 768 };
+}
+
+@interface UIRaycastGridTests : XCTestCase
+
+@end
+
+@implementation UIRaycastGridTests
+
+- (void)testQueryReturnsContainingEntriesDeepestFirst
+{
+    int a, b, c;
+    UIRaycastGrid grid(kScreen);
+    grid.Insert(&a, MakeRect(0, 0, 100, 100), 1);
+    grid.Insert(&b, MakeRect(50, 50, 150, 150), 3);
+    grid.Insert(&c, MakeRect(0, 0, 1024, 768), 2);
+
+    std::vector<void*> results;
+    grid.Query(75, 75, results);
+    XCTAssertEqual(results.size(), 3u);
+    XCTAssertTrue(results[0] == &b && results[1] == &c && results[2] == &a);
+
+    results.clear();
+    grid.Query(500, 500, results);
+    XCTAssertEqual(results.size(), 1u);
+    XCTAssertTrue(results[0] == &c);
+}
+
+- (void)testUpdateMovesEntryBetweenCells
+{
+    int a;
+    UIRaycastGrid grid(kScreen);
+    uint32_t handle = grid.Insert(&a, MakeRect(0, 0, 10, 10), 0);
+    XCTAssertTrue(grid.Update(handle, MakeRect(500, 500, 510, 510)));
+
+    std::vector<void*> results;
+    grid.Query(5, 5, results);
+    XCTAssertEqual(results.size(), 0u);
+    grid.Query(505, 505, results);
+    XCTAssertEqual(results.size(), 1u);
+}
+
+- (void)testDoubleRemoveLeavesFreeListIntact
+{
+    int a, b, c;
+    UIRaycastGrid grid(kScreen);
+    uint32_t handle = grid.Insert(&a, MakeRect(0, 0, 10, 10), 0);
+    XCTAssertTrue(grid.Remove(handle));
+    XCTAssertFalse(grid.Remove(handle));
+    XCTAssertFalse(grid.IsValid(handle));
+
+    // A corrupted free list would hand the same slot out twice.
+    uint32_t first = grid.Insert(&b, MakeRect(0, 0, 10, 10), 0);
+    uint32_t second = grid.Insert(&c, MakeRect(0, 0, 10, 10), 0);
+    XCTAssertNotEqual(first & UIRaycastGrid::kMaxEntries, second & UIRaycastGrid::kMaxEntries);
+
+    std::vector<void*> results;
+    grid.Query(5, 5, results);
+    XCTAssertEqual(results.size(), 2u);
+}
+
+- (void)testStaleHandleDoesNotTouchReusedSlot
+{
+    int a, b;
+    UIRaycastGrid grid(kScreen);
+    uint32_t stale = grid.Insert(&a, MakeRect(0, 0, 10, 10), 0);
+    grid.Remove(stale);
+    uint32_t handle = grid.Insert(&b, MakeRect(0, 0, 10, 10), 0);
+    XCTAssertNotEqual(stale, handle);
+
+    XCTAssertFalse(grid.Update(stale, MakeRect(500, 500, 510, 510)));
+    XCTAssertFalse(grid.SetDepth(stale, 5));
+    XCTAssertFalse(grid.Remove(stale));
+    XCTAssertTrue(grid.IsValid(handle));
+
+    std::vector<void*> results;
+    grid.Query(5, 5, results);
+    XCTAssertEqual(results.size(), 1u);
+    XCTAssertTrue(results[0] == &b);
+    XCTAssertFalse(grid.IsValid(UIRaycastGrid::kInvalidHandle));
+}
+
+- (void)testNaNIsRejected
+{
+    int a;
+    UIRaycastGrid grid(kScreen);
+    XCTAssertEqual(grid.Insert(&a, MakeRect(NAN, 0, 10, 10), 0), UIRaycastGrid::kInvalidHandle);
+
+    uint32_t handle = grid.Insert(&a, MakeRect(0, 0, 10, 10), 0);
+    XCTAssertFalse(grid.Update(handle, MakeRect(0, 0, 10, NAN)));
+
+    std::vector<void*> results;
+    grid.Query(NAN, 5, results);
+    XCTAssertEqual(results.size(), 0u);
+    grid.Query(5, 5, results);
+    XCTAssertEqual(results.size(), 1u);
+}
+
+- (void)testOutOfRangeCoordinatesClampToBorderCells
+{
+    int a;
+    UIRaycastGrid grid(kScreen);
+    uint32_t handle = grid.Insert(&a, MakeRect(-1e30f, -INFINITY, 1e30f, INFINITY), 0);
+    XCTAssertNotEqual(handle, UIRaycastGrid::kInvalidHandle);
+
+    std::vector<void*> results;
+    grid.Query(1e20f, -1e20f, results);
+    XCTAssertEqual(results.size(), 1u);
+
+    // Degenerate bounds still give a usable one cell grid.
+    grid.Resize(MakeRect(NAN, NAN, NAN, NAN), NAN);
+    results.clear();
+    grid.Query(0, 0, results);
+    XCTAssertEqual(results.size(), 1u);
+}
+
+@end
@@ -0,0 +1,126 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/UIRebuildScheduler.h"
+#include <map>
+
+using il2cpp::utils::UIRebuildScheduler;
+
+namespace
+{
+    struct FakeHierarchy
+    {
+        std::map<void*, int32_t> depths;
+        int computeCalls;
+    };
+
+    int32_t ComputeDepth(void* element, void* context)
+    {
+        FakeHierarchy* hierarchy = static_cast<FakeHierarchy*>(context);
+        hierarchy->computeCalls++;
+        return hierarchy->depths[element];
+    }
+}
+
+@interface UIRebuildSchedulerTests : XCTestCase
+
+@end
+
+@implementation UIRebuildSchedulerTests
+
+- (void)testLayoutPassListsParentsFirst
+{
+    int root, child, grandChild;
+    FakeHierarchy hierarchy;
+    hierarchy.computeCalls = 0;
+    hierarchy.depths[&root] = 0;
+    hierarchy.depths[&child] = 1;
+    hierarchy.depths[&grandChild] = 2;
+
+    UIRebuildScheduler scheduler(ComputeDepth, &hierarchy);
+    XCTAssertTrue(scheduler.IsIdle());
+    XCTAssertTrue(scheduler.RegisterForLayoutRebuild(&grandChild));
+    XCTAssertTrue(scheduler.RegisterForLayoutRebuild(&root));
+    XCTAssertTrue(scheduler.RegisterForLayoutRebuild(&child));
+    XCTAssertFalse(scheduler.RegisterForLayoutRebuild(&child));
+
+    const std::vector<void*>& pass = scheduler.BeginLayoutUpdate();
+    XCTAssertEqual(pass.size(), (size_t)3);
+    XCTAssertTrue(pass[0] == &root && pass[1] == &child && pass[2] == &grandChild);
+    scheduler.EndLayoutUpdate();
+    XCTAssertTrue(scheduler.IsIdle());
+
+    // Depths are cached between passes.
+    scheduler.RegisterForLayoutRebuild(&child);
+    XCTAssertEqual(hierarchy.computeCalls, 3);
+}
+
+- (void)testElementsForgottenDuringAPassAreDroppedWhenItEnds
+{
+    int element;
+    FakeHierarchy hierarchy;
+    hierarchy.computeCalls = 0;
+    hierarchy.depths[&element] = 5;
+
+    UIRebuildScheduler scheduler(ComputeDepth, &hierarchy);
+    scheduler.RegisterForLayoutRebuild(&element);
+    scheduler.BeginLayoutUpdate();
+    scheduler.Forget(&element);
+    scheduler.EndLayoutUpdate();
+
+    // A new element at the same address must get its own depth, not the destroyed one's.
+    hierarchy.depths[&element] = 0;
+    XCTAssertTrue(scheduler.RegisterForLayoutRebuild(&element));
+    XCTAssertEqual(hierarchy.computeCalls, 2);
+    scheduler.BeginLayoutUpdate();
+    scheduler.EndLayoutUpdate();
+}
+
+- (void)testElementsForgottenDuringTheGraphicPassAreDroppedWhenItEnds
+{
+    int element;
+    FakeHierarchy hierarchy;
+    hierarchy.computeCalls = 0;
+    hierarchy.depths[&element] = 3;
+
+    UIRebuildScheduler scheduler(ComputeDepth, &hierarchy);
+    scheduler.RegisterForLayoutRebuild(&element);
+    scheduler.BeginLayoutUpdate();
+    scheduler.EndLayoutUpdate();
+    scheduler.RegisterForGraphicRebuild(&element);
+
+    const std::vector<void*>& graphics = scheduler.BeginGraphicUpdate();
+    XCTAssertEqual(graphics.size(), (size_t)1);
+    scheduler.Forget(&element);
+    scheduler.EndGraphicUpdate();
+
+    hierarchy.depths[&element] = 1;
+    scheduler.RegisterForLayoutRebuild(&element);
+    XCTAssertEqual(hierarchy.computeCalls, 2);
+}
+
+- (void)testAnElementReusingAnAddressDuringThePassKeepsItsEntry
+{
+    int element;
+    FakeHierarchy hierarchy;
+    hierarchy.computeCalls = 0;
+    hierarchy.depths[&element] = 2;
+
+    UIRebuildScheduler scheduler(ComputeDepth, &hierarchy);
+    scheduler.RegisterForGraphicRebuild(&element);
+    scheduler.BeginGraphicUpdate();
+    scheduler.Forget(&element);
+
+    // The new element registers for layout before the graphic pass ends.
+    hierarchy.depths[&element] = 0;
+    XCTAssertTrue(scheduler.RegisterForLayoutRebuild(&element));
+    scheduler.EndGraphicUpdate();
+
+    XCTAssertFalse(scheduler.IsIdle());
+    const std::vector<void*>& pass = scheduler.BeginLayoutUpdate();
+    XCTAssertEqual(pass.size(), (size_t)1);
+    XCTAssertTrue(pass[0] == &element);
+    scheduler.EndLayoutUpdate();
+    XCTAssertEqual(hierarchy.computeCalls, 1);
+}
+
+@end
@@ -0,0 +1,135 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/UIClipping.h"
+
+using il2cpp::utils::UIClipRect;
+using il2cpp::utils::UIClipping;
+using il2cpp::utils::UIRectClipper;
+
+static UIClipRect MakeRect(float xMin, float yMin, float xMax, float yMax)
+{
+    UIClipRect rect = { xMin, yMin, xMax, yMax };
+    return rect;
+}
+
+static const UIRectClipper::Change* FindChange(const std::vector<UIRectClipper::Change>& changes, void* target)
+{
+    for (size_t i = 0; i < changes.size(); i++)
+    {
+        if (changes[i].target == target)
+            return &changes[i];
+    }
+    return NULL;
+}
+
+@interface UIRectClipperTests : XCTestCase
+
+@end
+
+@implementation UIRectClipperTests
+
+- (void)testFindCullAndClipRectIntersectsAllParents
+{
+    UIClipRect parents[] = { MakeRect(0, 0, 100, 100), MakeRect(50, -10, 200, 80), MakeRect(-5, 10, 90, 300) };
+
+    bool validRect;
+    UIClipRect clipRect = UIClipping::FindCullAndClipRect(parents, 3, &validRect);
+    XCTAssertTrue(validRect);
+    XCTAssertTrue(clipRect == MakeRect(50, 10, 90, 80));
+}
+
+- (void)testFindCullAndClipRectReportsEmptyIntersectionsAsZero
+{
+    UIClipRect parents[] = { MakeRect(0, 0, 10, 10), MakeRect(20, 0, 30, 10) };
+
+    bool validRect = true;
+    UIClipRect clipRect = UIClipping::FindCullAndClipRect(parents, 2, &validRect);
+    XCTAssertFalse(validRect);
+    XCTAssertTrue(clipRect == MakeRect(0, 0, 0, 0));
+
+    validRect = true;
+    UIClipping::FindCullAndClipRect(NULL, 0, &validRect);
+    XCTAssertFalse(validRect);
+}
+
+- (void)testCullRectsCullsChildrenOutsideTheClipRect
+{
+    UIClipRect clipRect = MakeRect(0, 0, 10, 10);
+    UIClipRect children[] =
+    {
+        MakeRect(2, 2, 8, 8),       // inside
+        MakeRect(-5, -5, 1, 1),     // overlapping a corner
+        MakeRect(10, 0, 20, 10),    // touching the right edge only
+        MakeRect(0, 11, 10, 20),    // above
+        MakeRect(-10, -10, 20, 20)  // containing the clip rect
+    };
+    uint8_t culled[5];
+
+    UIClipping::CullRects(clipRect, true, children, 5, culled);
+    XCTAssertEqual(culled[0], 0);
+    XCTAssertEqual(culled[1], 0);
+    XCTAssertEqual(culled[2], 1);
+    XCTAssertEqual(culled[3], 1);
+    XCTAssertEqual(culled[4], 0);
+
+    UIClipping::CullRects(clipRect, false, children, 5, culled);
+    for (size_t i = 0; i < 5; i++)
+        XCTAssertEqual(culled[i], 1);
+}
+
+- (void)testPerformClippingOnlyReportsChildrenWhoseStateChanged
+{
+    int inside, outside;
+    UIRectClipper clipper;
+    clipper.AddChild(&inside, MakeRect(10, 10, 20, 20));
+    uint32_t outsideIndex = clipper.AddChild(&outside, MakeRect(200, 200, 210, 210));
+    UIClipRect parent = MakeRect(0, 0, 100, 100);
+
+    // New children always get their clip rect and cull state.
+    const std::vector<UIRectClipper::Change>& first = clipper.PerformClipping(&parent, 1);
+    XCTAssertEqual(first.size(), (size_t)2);
+    XCTAssertTrue(FindChange(first, &inside) != NULL && !FindChange(first, &inside)->culled);
+    XCTAssertTrue(FindChange(first, &outside) != NULL && FindChange(first, &outside)->culled);
+    XCTAssertTrue(FindChange(first, &inside)->clipRectChanged);
+
+    // Nothing moved: no work.
+    XCTAssertEqual(clipper.PerformClipping(&parent, 1).size(), (size_t)0);
+
+    // One child moves into view: only it is reported, without a clip rect update.
+    clipper.SetChildRect(outsideIndex, MakeRect(50, 50, 60, 60));
+    const std::vector<UIRectClipper::Change>& moved = clipper.PerformClipping(&parent, 1);
+    XCTAssertEqual(moved.size(), (size_t)1);
+    XCTAssertTrue(moved[0].target == &outside);
+    XCTAssertFalse(moved[0].culled);
+    XCTAssertFalse(moved[0].clipRectChanged);
+
+    // The mask moved: every child needs the new clip rect.
+    UIClipRect movedParent = MakeRect(0, 0, 15, 15);
+    const std::vector<UIRectClipper::Change>& reclipped = clipper.PerformClipping(&movedParent, 1);
+    XCTAssertEqual(reclipped.size(), (size_t)2);
+    XCTAssertTrue(FindChange(reclipped, &inside)->clipRectChanged && !FindChange(reclipped, &inside)->culled);
+    XCTAssertTrue(FindChange(reclipped, &outside)->clipRectChanged && FindChange(reclipped, &outside)->culled);
+    XCTAssertTrue(clipper.GetClipRect() == movedParent);
+}
+
+- (void)testRemoveChildMovesTheLastChildIntoTheFreedIndex
+{
+    int first, second, third;
+    UIRectClipper clipper;
+    clipper.AddChild(&first, MakeRect(0, 0, 1, 1));
+    clipper.AddChild(&second, MakeRect(0, 0, 1, 1));
+    clipper.AddChild(&third, MakeRect(0, 0, 1, 1));
+    UIClipRect parent = MakeRect(0, 0, 100, 100);
+    clipper.PerformClipping(&parent, 1);
+
+    XCTAssertTrue(clipper.RemoveChild(0) == &third);
+    XCTAssertEqual(clipper.GetChildCount(), (size_t)2);
+    XCTAssertTrue(clipper.GetChildTarget(0) == &third);
+    XCTAssertTrue(clipper.RemoveChild(1) == NULL);
+    XCTAssertEqual(clipper.GetChildCount(), (size_t)1);
+
+    // Removal re-tests the remaining children once, which reports nothing new here.
+    XCTAssertEqual(clipper.PerformClipping(&parent, 1).size(), (size_t)0);
+}
+
+@end
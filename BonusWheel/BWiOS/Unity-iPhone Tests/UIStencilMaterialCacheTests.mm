@@ -0,0 +1,129 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/UIStencilMaterialCache.h"
+#include <vector>
+
+using il2cpp::utils::UIStencilMaterialCache;
+
+namespace
+{
+    // Stands in for the Material objects: created variants are heap ints holding the
+    // stencil id, destroyed ones are recorded.
+    struct MaterialLog
+    {
+        int created;
+        std::vector<void*> destroyed;
+
+        MaterialLog() : created(0) {}
+    };
+
+    void* CreateMaterial(const UIStencilMaterialCache::Key& key, void* context)
+    {
+        static_cast<MaterialLog*>(context)->created++;
+        return new int(key.stencilId);
+    }
+
+    void DestroyMaterial(void* material, void* context)
+    {
+        static_cast<MaterialLog*>(context)->destroyed.push_back(material);
+        delete static_cast<int*>(material);
+    }
+
+    UIStencilMaterialCache::Key MakeKey(void* baseMaterial, int32_t stencilId)
+    {
+        UIStencilMaterialCache::Key key = { baseMaterial, stencilId, 2, 3, 255, 255, UIStencilMaterialCache::kColorWriteMaskAll };
+        return key;
+    }
+}
+
+@interface UIStencilMaterialCacheTests : XCTestCase
+
+@end
+
+@implementation UIStencilMaterialCacheTests
+
+- (void)testAddSharesVariantPerKey
+{
+    int baseMaterial;
+    MaterialLog log;
+    UIStencilMaterialCache cache(CreateMaterial, DestroyMaterial, &log);
+
+    void* first = cache.Add(MakeKey(&baseMaterial, 1));
+    void* second = cache.Add(MakeKey(&baseMaterial, 1));
+    void* other = cache.Add(MakeKey(&baseMaterial, 2));
+
+    XCTAssertTrue(first == second);
+    XCTAssertTrue(first != other);
+    XCTAssertEqual(log.created, 2);
+    XCTAssertEqual(cache.GetReferenceCount(first), 2u);
+    XCTAssertEqual(cache.GetMaterialCount(), 2u);
+    XCTAssertEqual(cache.GetHitCount(), 1u);
+    XCTAssertEqual(cache.GetMissCount(), 2u);
+}
+
+- (void)testLastRemoveDestroysVariant
+{
+    int baseMaterial;
+    MaterialLog log;
+    UIStencilMaterialCache cache(CreateMaterial, DestroyMaterial, &log);
+
+    void* material = cache.Add(MakeKey(&baseMaterial, 1));
+    cache.Add(MakeKey(&baseMaterial, 1));
+
+    cache.Remove(material);
+    XCTAssertEqual(cache.GetReferenceCount(material), 1u);
+    XCTAssertEqual(log.destroyed.size(), 0u);
+
+    cache.Remove(material);
+    XCTAssertEqual(log.destroyed.size(), 1u);
+    XCTAssertTrue(log.destroyed[0] == material);
+    XCTAssertEqual(cache.GetMaterialCount(), 0u);
+
+    // The key is free again and gets a fresh variant.
+    void* recreated = cache.Add(MakeKey(&baseMaterial, 1));
+    XCTAssertEqual(log.created, 2);
+    XCTAssertEqual(cache.GetReferenceCount(recreated), 1u);
+}
+
+- (void)testUnusedStencilReturnsBaseMaterialUncounted
+{
+    int baseMaterial;
+    MaterialLog log;
+    UIStencilMaterialCache cache(CreateMaterial, DestroyMaterial, &log);
+
+    XCTAssertTrue(cache.Add(MakeKey(&baseMaterial, 0)) == &baseMaterial);
+    XCTAssertTrue(cache.Add(MakeKey(NULL, 1)) == NULL);
+
+    // A color mask alone is enough to need a variant.
+    UIStencilMaterialCache::Key colorMasked = MakeKey(&baseMaterial, 0);
+    colorMasked.colorWriteMask = 0;
+    XCTAssertTrue(cache.Add(colorMasked) != &baseMaterial);
+
+    XCTAssertEqual(log.created, 1);
+    XCTAssertEqual(cache.GetReferenceCount(&baseMaterial), 0u);
+
+    // Materials the cache did not hand out are ignored.
+    cache.Remove(&baseMaterial);
+    XCTAssertEqual(log.destroyed.size(), 0u);
+}
+
+- (void)testClearDestroysEveryVariant
+{
+    int baseMaterial;
+    MaterialLog log;
+    UIStencilMaterialCache cache(CreateMaterial, DestroyMaterial, &log);
+
+    void* first = cache.Add(MakeKey(&baseMaterial, 1));
+    cache.Add(MakeKey(&baseMaterial, 1));
+    cache.Add(MakeKey(&baseMaterial, 2));
+    cache.Clear();
+
+    XCTAssertEqual(log.destroyed.size(), 2u);
+    XCTAssertEqual(cache.GetMaterialCount(), 0u);
+    XCTAssertEqual(cache.GetReferenceCount(first), 0u);
+
+    cache.Add(MakeKey(&baseMaterial, 1));
+    XCTAssertEqual(log.created, 3);
+}
+
+@end
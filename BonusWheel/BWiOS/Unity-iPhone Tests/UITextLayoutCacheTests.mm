@@ -0,0 +1,154 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/UITextLayoutCache.h"
+#include <string.h>
+
+using il2cpp::utils::UITextLayoutCache;
+using il2cpp::utils::UIVertex;
+
+namespace
+{
+    const Il2CppChar kHello[] = { 'H', 'e', 'l', 'l', 'o' };
+    const Il2CppChar kWorld[] = { 'W', 'o', 'r', 'l', 'd' };
+    const int kFont = 0;
+
+    UITextLayoutCache::Settings MakeSettings()
+    {
+        UITextLayoutCache::Settings settings;
+        memset(&settings, 0, sizeof(settings));
+        settings.font = &kFont;
+        settings.color.r = settings.color.g = settings.color.b = settings.color.a = 255;
+        settings.fontSize = 14;
+        settings.resizeTextMinSize = 10;
+        settings.resizeTextMaxSize = 40;
+        settings.lineSpacing = 1.0f;
+        settings.scaleFactor = 1.0f;
+        settings.width = 160.0f;
+        settings.height = 30.0f;
+        settings.pivot.x = 0.5f;
+        settings.pivot.y = 0.5f;
+        settings.richText = true;
+        settings.updateBounds = true;
+        return settings;
+    }
+
+    void StoreQuad(UITextLayoutCache& cache, const Il2CppChar* text, size_t length, const UITextLayoutCache::Settings& settings, float x)
+    {
+        UIVertex quad[4];
+        memset(quad, 0, sizeof(quad));
+        quad[0].position.x = x;
+        cache.Store(text, length, settings, quad, 4);
+    }
+
+    bool Cached(UITextLayoutCache& cache, const UITextLayoutCache::Settings& settings)
+    {
+        size_t vertexCount;
+        return cache.Find(kHello, 5, settings, &vertexCount) != NULL;
+    }
+}
+
+@interface UITextLayoutCacheTests : XCTestCase
+
+@end
+
+@implementation UITextLayoutCacheTests
+
+- (void)testFindReturnsStoredVertices
+{
+    UITextLayoutCache cache;
+    UITextLayoutCache::Settings settings = MakeSettings();
+    StoreQuad(cache, kHello, 5, settings, 7.0f);
+
+    size_t vertexCount;
+    const UIVertex* vertices = cache.Find(kHello, 5, settings, &vertexCount);
+    XCTAssertTrue(vertices != NULL);
+    XCTAssertEqual(vertexCount, 4u);
+    XCTAssertEqual(vertices[0].position.x, 7.0f);
+
+    XCTAssertTrue(cache.Find(kWorld, 5, settings, &vertexCount) == NULL);
+    XCTAssertTrue(cache.Find(kHello, 4, settings, &vertexCount) == NULL);
+    XCTAssertEqual(cache.GetHitCount(), 1u);
+    XCTAssertEqual(cache.GetMissCount(), 2u);
+}
+
+// Each of these used to be left to a caller supplied fold of the settings, where two
+// different values could collide and share a layout.
+- (void)testEverySettingIsPartOfTheKey
+{
+    UITextLayoutCache cache;
+    const UITextLayoutCache::Settings base = MakeSettings();
+    StoreQuad(cache, kHello, 5, base, 0.0f);
+    XCTAssertTrue(Cached(cache, base));
+
+    UITextLayoutCache::Settings changed[15];
+    for (size_t i = 0; i < 15; i++)
+        changed[i] = base;
+    changed[0].color.a = 128;
+    changed[1].fontStyle = 1;
+    changed[2].alignment = 4;
+    changed[3].horizontalOverflow = 1;
+    changed[4].verticalOverflow = 1;
+    changed[5].resizeTextMaxSize = 41;
+    changed[6].lineSpacing = 1.5f;
+    changed[7].scaleFactor = 2.0f;
+    changed[8].width = 161.0f;
+    changed[9].pivot.y = 0.0f;
+    changed[10].richText = false;
+    changed[11].resizeTextForBestFit = true;
+    changed[12].alignByGeometry = true;
+    changed[13].updateBounds = false;
+    changed[14].generateOutOfBounds = true;
+
+    for (size_t i = 0; i < 15; i++)
+        XCTAssertFalse(Cached(cache, changed[i]), @"setting %d", (int)i);
+}
+
+- (void)testNegativeZeroMatchesZero
+{
+    UITextLayoutCache cache;
+    UITextLayoutCache::Settings settings = MakeSettings();
+    settings.pivot.x = 0.0f;
+    StoreQuad(cache, kHello, 5, settings, 0.0f);
+
+    settings.pivot.x = -0.0f;
+    XCTAssertTrue(Cached(cache, settings));
+}
+
+- (void)testLeastRecentlyUsedEntryIsEvicted
+{
+    UITextLayoutCache cache(2);
+    UITextLayoutCache::Settings first = MakeSettings();
+    UITextLayoutCache::Settings second = MakeSettings();
+    UITextLayoutCache::Settings third = MakeSettings();
+    second.fontSize = 15;
+    third.fontSize = 16;
+
+    StoreQuad(cache, kHello, 5, first, 0.0f);
+    StoreQuad(cache, kHello, 5, second, 0.0f);
+    XCTAssertTrue(Cached(cache, first));
+    StoreQuad(cache, kHello, 5, third, 0.0f);
+
+    XCTAssertEqual(cache.GetEntryCount(), 2u);
+    XCTAssertTrue(Cached(cache, first));
+    XCTAssertFalse(Cached(cache, second));
+    XCTAssertTrue(Cached(cache, third));
+}
+
+- (void)testInvalidateFontDropsOnlyThatFont
+{
+    const int otherFont = 0;
+    UITextLayoutCache cache;
+    UITextLayoutCache::Settings settings = MakeSettings();
+    UITextLayoutCache::Settings other = MakeSettings();
+    other.font = &otherFont;
+
+    StoreQuad(cache, kHello, 5, settings, 0.0f);
+    StoreQuad(cache, kHello, 5, other, 0.0f);
+    cache.InvalidateFont(&kFont);
+
+    XCTAssertFalse(Cached(cache, settings));
+    XCTAssertTrue(Cached(cache, other));
+    XCTAssertEqual(cache.GetVertexCount(), 4u);
+}
+
+@end
@@ -0,0 +1,165 @@
+#import <XCTest/XCTest.h>
+
+#include "utils/UIVertexBuffer.h"
+
+using il2cpp::utils::UIColor32;
+using il2cpp::utils::UIVector2;
+using il2cpp::utils::UIVector3;
+using il2cpp::utils::UIVertex;
+using il2cpp::utils::UIVertexBuffer;
+
+static UIVector2 MakeVector(float x, float y)
+{
+    UIVector2 vector = { x, y };
+    return vector;
+}
+
+static const UIColor32 kWhite = { 255, 255, 255, 255 };
+
+@interface UIVertexBufferTests : XCTestCase
+
+@end
+
+@implementation UIVertexBufferTests
+
+- (void)testAddRectUsesVertexHelperLayout
+{
+    UIVertexBuffer buffer;
+    buffer.AddRect(MakeVector(0, 0), MakeVector(10, 20), kWhite, MakeVector(0, 0), MakeVector(1, 1));
+
+    UIVertexBuffer::MeshData mesh = buffer.GetMeshData();
+    XCTAssertEqual(mesh.vertexCount, 4u);
+    XCTAssertEqual(mesh.indexCount, 6u);
+
+    // Bottom left, top left, top right, bottom right; triangles 0-1-2 and 2-3-0.
+    XCTAssertTrue(mesh.positions[1].x == 0 && mesh.positions[1].y == 20);
+    XCTAssertTrue(mesh.positions[3].x == 10 && mesh.positions[3].y == 0);
+    XCTAssertTrue(mesh.uv0[2].x == 1 && mesh.uv0[2].y == 1);
+    const int32_t expected[] = { 0, 1, 2, 2, 3, 0 };
+    XCTAssertEqual(memcmp(mesh.indices, expected, sizeof(expected)), 0);
+
+    // Channels VertexHelper fills with defaults.
+    XCTAssertTrue(mesh.normals[0].z == -1.0f);
+    XCTAssertTrue(mesh.tangents[0].x == 1.0f && mesh.tangents[0].w == -1.0f);
+    XCTAssertTrue(mesh.uv1[3].x == 0 && mesh.uv3[3].y == 0);
+}
+
+- (void)testSlicedGridSkipsCenterUnlessFilled
+{
+    const float x[4] = { 0, 5, 95, 100 };
+    const float y[4] = { 0, 5, 45, 50 };
+    const float u[4] = { 0, 0.1f, 0.9f, 1 };
+    const float v[4] = { 0, 0.1f, 0.9f, 1 };
+
+    UIVertexBuffer buffer;
+    buffer.AddSlicedGrid(x, y, u, v, kWhite, false);
+    XCTAssertEqual(buffer.GetVertexCount(), 32u);
+    XCTAssertEqual(buffer.GetIndexCount(), 48u);
+
+    buffer.Clear();
+    buffer.AddSlicedGrid(x, y, u, v, kWhite, true);
+    XCTAssertEqual(buffer.GetVertexCount(), 36u);
+
+    // Cells go column by column; the fifth one is the center.
+    UIVertexBuffer::MeshData mesh = buffer.GetMeshData();
+    XCTAssertTrue(mesh.positions[16].x == 5 && mesh.positions[16].y == 5);
+    XCTAssertTrue(mesh.uv0[18].x == 0.9f && mesh.uv0[18].y == 0.9f);
+}
+
+- (void)testTiledRectCropsLastTiles
+{
+    UIVertexBuffer buffer;
+    XCTAssertTrue(buffer.AddTiledRect(MakeVector(0, 0), MakeVector(25, 10), MakeVector(10, 10), kWhite, MakeVector(0, 0), MakeVector(1, 1)));
+    XCTAssertEqual(buffer.GetVertexCount(), 12u);
+    XCTAssertEqual(buffer.GetIndexCount(), 18u);
+
+    // The third tile is half a tile wide and shows half the texture.
+    UIVertexBuffer::MeshData mesh = buffer.GetMeshData();
+    XCTAssertTrue(mesh.positions[8].x == 20 && mesh.positions[10].x == 25);
+    XCTAssertTrue(mesh.uv0[10].x == 0.5f && mesh.uv0[10].y == 1);
+}
+
+// Ten 0.01f tiles end a few ulps short of 0.1f, so covering 0.1f takes an eleventh sliver
+// tile. The tile count used to be estimated in float, which rounds 0.1f / 0.01f to exactly
+// 10, and the emitting loop stopped at that estimate, leaving the sliver uncovered. Every
+// tile has to start where the previous one ended and the last one has to end at max.
+- (void)testTiledRectCoversRangeDespiteFloatRounding
+{
+    const float max = 0.1f;
+    const float tile = 0.01f;
+    const size_t tilesPerRow = 11;
+
+    UIVertexBuffer buffer;
+    XCTAssertTrue(buffer.AddTiledRect(MakeVector(0, 0), MakeVector(max, max), MakeVector(tile, tile), kWhite, MakeVector(0, 0), MakeVector(1, 1)));
+    XCTAssertEqual(buffer.GetVertexCount(), tilesPerRow * tilesPerRow * 4);
+
+    UIVertexBuffer::MeshData mesh = buffer.GetMeshData();
+    for (size_t row = 0; row < tilesPerRow; row++)
+    {
+        float previousRight = 0;
+        for (size_t column = 0; column < tilesPerRow; column++)
+        {
+            const UIVector3* quad = &mesh.positions[(row * tilesPerRow + column) * 4];
+            XCTAssertEqual(quad[0].x, previousRight);
+            XCTAssertTrue(quad[2].x > quad[0].x);
+            previousRight = quad[2].x;
+        }
+        XCTAssertEqual(previousRight, max);
+    }
+    XCTAssertEqual(mesh.positions[mesh.vertexCount - 2].y, max);
+}
+
+- (void)testTiledRectRefusesToExceedVertexLimit
+{
+    UIVertexBuffer buffer;
+    XCTAssertFalse(buffer.AddTiledRect(MakeVector(0, 0), MakeVector(1000, 1000), MakeVector(1, 1), kWhite, MakeVector(0, 0), MakeVector(1, 1)));
+    XCTAssertEqual(buffer.GetVertexCount(), 0u);
+
+    // Degenerate input emits nothing but is not an overflow.
+    XCTAssertTrue(buffer.AddTiledRect(MakeVector(0, 0), MakeVector(10, 10), MakeVector(0, 1), kWhite, MakeVector(0, 0), MakeVector(1, 1)));
+    XCTAssertEqual(buffer.GetVertexCount(), 0u);
+}
+
+- (void)testStripKeepsWindingConsistent
+{
+    const UIVector3 positions[5] = { { 0, 0, 0 }, { 0, 1, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 2, 0, 0 } };
+    const UIVector2 uvs[5] = {};
+
+    UIVertexBuffer buffer;
+    buffer.AddStrip(positions, uvs, 5, kWhite);
+    XCTAssertEqual(buffer.GetIndexCount(), 9u);
+
+    UIVertexBuffer::MeshData mesh = buffer.GetMeshData();
+    for (size_t triangle = 0; triangle < 3; triangle++)
+    {
+        const UIVector3& a = mesh.positions[mesh.indices[triangle * 3]];
+        const UIVector3& b = mesh.positions[mesh.indices[triangle * 3 + 1]];
+        const UIVector3& c = mesh.positions[mesh.indices[triangle * 3 + 2]];
+        float cross = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        XCTAssertTrue(cross < 0);
+    }
+}
+
+- (void)testGlyphQuadsAreScaledAndOffset
+{
+    UIVertex glyph[4] = {};
+    for (int i = 0; i < 4; i++)
+    {
+        glyph[i].position.x = (float)(i / 2) * 8;
+        glyph[i].position.y = (float)(i % 2) * 8;
+        glyph[i].color = kWhite;
+    }
+
+    UIVertexBuffer buffer;
+    buffer.AddGlyphQuads(glyph, 1, 0.5f, MakeVector(1, 2));
+    UIVertex vertex = buffer.GetVertex(3);
+    XCTAssertEqual(vertex.position.x, 5.0f);
+    XCTAssertEqual(vertex.position.y, 6.0f);
+    XCTAssertEqual(buffer.GetIndexCount(), 6u);
+
+    UIVertex stream[6];
+    buffer.GetVertexStream(stream);
+    XCTAssertEqual(stream[5].position.x, 1.0f);
+}
+
+@end